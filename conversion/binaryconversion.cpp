@@ -0,0 +1,814 @@
+#include "./binaryconversion.h"
+#include "./conversionexception.h"
+
+#include "../misc/cpufeaturesprivate.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <type_traits>
+
+namespace CppUtilities {
+
+/// \cond
+namespace Detail {
+
+/*!
+ * \brief Defines the unsigned integer type with the specified \a width in bytes.
+ */
+template <std::size_t width> struct UnsignedOfWidth;
+template <> struct UnsignedOfWidth<2> {
+    using type = std::uint16_t;
+};
+template <> struct UnsignedOfWidth<4> {
+    using type = std::uint32_t;
+};
+template <> struct UnsignedOfWidth<8> {
+    using type = std::uint64_t;
+};
+
+/*!
+ * \brief Swaps the byte order of \a count values of the specified \a width going from \a src to \a dst.
+ * \remarks \a src and \a dst may be equal but must not overlap otherwise.
+ */
+template <std::size_t width> inline void swapBytesScalar(const char *src, char *dst, std::size_t count)
+{
+    using ValueType = typename UnsignedOfWidth<width>::type;
+    for (const char *const end = src + count * width; src != end; src += width, dst += width) {
+        auto value = ValueType();
+        std::memcpy(&value, src, width);
+        value = swapOrder(value);
+        std::memcpy(dst, &value, width);
+    }
+}
+
+#ifdef CPP_UTILITIES_X86_DISPATCH
+/*!
+ * \brief Returns the byte index of the specified \a index within a 16-byte lane when swapping elements of the specified \a width.
+ */
+constexpr char swappedIndex(std::size_t width, std::size_t index)
+{
+    return static_cast<char>(index - (index % width) + (width - 1 - (index % width)));
+}
+
+/*!
+ * \brief Returns the byte shuffle mask to swap the byte order of elements of the specified \a width.
+ */
+template <std::size_t width> CPP_UTILITIES_TARGET("ssse3") inline __m128i swapMask128()
+{
+    return _mm_setr_epi8(swappedIndex(width, 0), swappedIndex(width, 1), swappedIndex(width, 2), swappedIndex(width, 3), swappedIndex(width, 4),
+        swappedIndex(width, 5), swappedIndex(width, 6), swappedIndex(width, 7), swappedIndex(width, 8), swappedIndex(width, 9),
+        swappedIndex(width, 10), swappedIndex(width, 11), swappedIndex(width, 12), swappedIndex(width, 13), swappedIndex(width, 14),
+        swappedIndex(width, 15));
+}
+
+template <std::size_t width> CPP_UTILITIES_TARGET("ssse3") void swapBytesSsse3(const char *src, char *dst, std::size_t count)
+{
+    const auto mask = swapMask128<width>();
+    auto size = count * width;
+    for (; size >= 16; size -= 16, src += 16, dst += 16) {
+        const auto block = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dst), _mm_shuffle_epi8(block, mask));
+    }
+    swapBytesScalar<width>(src, dst, size / width);
+}
+
+template <std::size_t width> CPP_UTILITIES_TARGET("avx2") void swapBytesAvx2(const char *src, char *dst, std::size_t count)
+{
+    const auto mask = _mm256_broadcastsi128_si256(swapMask128<width>());
+    auto size = count * width;
+    for (; size >= 32; size -= 32, src += 32, dst += 32) {
+        const auto block = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(src));
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(dst), _mm256_shuffle_epi8(block, mask));
+    }
+    swapBytesSsse3<width>(src, dst, size / width);
+}
+
+template <std::size_t width> CPP_UTILITIES_TARGET("avx512bw") void swapBytesAvx512(const char *src, char *dst, std::size_t count)
+{
+    const auto mask = _mm512_broadcast_i32x4(swapMask128<width>());
+    auto size = count * width;
+    for (; size >= 64; size -= 64, src += 64, dst += 64) {
+        const auto block = _mm512_loadu_si512(src);
+        _mm512_storeu_si512(dst, _mm512_shuffle_epi8(block, mask));
+    }
+    swapBytesAvx2<width>(src, dst, size / width);
+}
+#endif
+
+/*!
+ * \brief Swaps the byte order of \a count values of the specified \a width going from \a src to \a dst using the
+ *        best kernel the CPU supports.
+ * \remarks \a src and \a dst may be equal but must not overlap otherwise.
+ */
+template <std::size_t width> void swapBytes(const char *src, char *dst, std::size_t count)
+{
+#ifdef CPP_UTILITIES_X86_DISPATCH
+    if (CpuFeatures::hasAvx512bw()) {
+        swapBytesAvx512<width>(src, dst, count);
+        return;
+    }
+    if (CpuFeatures::hasAvx2()) {
+        swapBytesAvx2<width>(src, dst, count);
+        return;
+    }
+    if (CpuFeatures::hasSsse3()) {
+        swapBytesSsse3<width>(src, dst, count);
+        return;
+    }
+#endif
+    swapBytesScalar<width>(src, dst, count);
+}
+
+/*!
+ * \brief Copies \a count values of the specified \a width (2, 4 or 8 bytes) from \a src to \a dst swapping their byte order.
+ * \remarks This is the non-template entry point for the bulk conversions within the BE and LE namespaces.
+ */
+void copyWithSwappedOrder(const char *src, char *dst, std::size_t count, std::size_t width)
+{
+    switch (width) {
+    case 2:
+        swapBytes<2>(src, dst, count);
+        break;
+    case 4:
+        swapBytes<4>(src, dst, count);
+        break;
+    case 8:
+        swapBytes<8>(src, dst, count);
+        break;
+    default:
+        std::memmove(dst, src, count * width);
+    }
+}
+
+/*!
+ * \brief Decodes one LEB128 encoded integer from \a current to \a end into \a value and advances \a current.
+ * \returns Returns whether the integer was complete; \a current is not advanced otherwise.
+ * \throws Throws ConversionException if the integer exceeds 64 bit.
+ */
+inline bool fromVarUInt64Scalar(const char *&current, const char *end, std::uint64_t &value)
+{
+    auto result = std::uint64_t();
+    for (auto i = std::size_t(), shift = std::size_t(); current + i != end; ++i, shift += 7) {
+        const auto byte = static_cast<std::uint8_t>(current[i]);
+        if (i == 9 && byte > 1) {
+            throw ConversionException("LEB128 encoded integer exceeds 64 bit.");
+        }
+        result |= static_cast<std::uint64_t>(byte & 0x7F) << shift;
+        if (!(byte & 0x80)) {
+            current += i + 1;
+            value = result;
+            return true;
+        }
+    }
+    return false;
+}
+
+inline std::size_t fromVarUInt64sScalar(const char *&data, const char *end, std::uint64_t *values, std::size_t maxCount)
+{
+    auto count = std::size_t();
+    for (; count != maxCount && fromVarUInt64Scalar(data, end, values[count]); ++count)
+        ;
+    return count;
+}
+
+#ifdef CPP_UTILITIES_X86_DISPATCH
+/*!
+ * \brief Decodes LEB128 encoded integers processing blocks of 16 bytes.
+ * \remarks
+ * - The terminating bytes of all integers ending within a block are determined at once via the movemask of the
+ *   continuation bits. Blocks only containing single-byte integers are zero-extended via unpacking. Otherwise the
+ *   7-bit groups of each integer are gathered via PEXT (instead of a shuffle table as used by Masked-VByte).
+ * - Falls back to the scalar implementation for the remaining bytes and when encountering an integer which is longer
+ *   than 10 bytes or exceeds 64 bit (so the scalar implementation throws the exception).
+ */
+CPP_UTILITIES_TARGET("sse2,bmi2") std::size_t fromVarUInt64sBmi2(const char *&data, const char *end, std::uint64_t *values, std::size_t maxCount)
+{
+    constexpr auto payloadBits = std::uint64_t(0x7F7F7F7F7F7F7F7F);
+    const auto zero = _mm_setzero_si128();
+    const auto *current = data;
+    auto count = std::size_t();
+    // require 32 bytes so loading 8 bytes at any offset within the block (and 2 bytes after those) stays within bounds
+    while (end - current >= 32 && maxCount - count >= 16) {
+        const auto block = _mm_loadu_si128(reinterpret_cast<const __m128i *>(current));
+        const auto continuationBits = static_cast<unsigned int>(_mm_movemask_epi8(block));
+        if (!continuationBits) {
+            const auto low = _mm_unpacklo_epi8(block, zero), high = _mm_unpackhi_epi8(block, zero);
+            const __m128i quarters[] = { _mm_unpacklo_epi16(low, zero), _mm_unpackhi_epi16(low, zero), _mm_unpacklo_epi16(high, zero),
+                _mm_unpackhi_epi16(high, zero) };
+            auto *output = reinterpret_cast<__m128i *>(values + count);
+            for (const auto &quarter : quarters) {
+                _mm_storeu_si128(output++, _mm_unpacklo_epi32(quarter, zero));
+                _mm_storeu_si128(output++, _mm_unpackhi_epi32(quarter, zero));
+            }
+            current += 16;
+            count += 16;
+            continue;
+        }
+        auto terminators = ~continuationBits & 0xFFFFu;
+        if (!terminators) {
+            break; // integers can not be longer than 10 bytes
+        }
+        auto offset = 0u;
+        for (; terminators; terminators &= terminators - 1) {
+            const auto next = static_cast<unsigned int>(__builtin_ctz(terminators)) + 1;
+            const auto length = next - offset;
+            const auto word = LE::toInt<std::uint64_t>(current + offset);
+            if (length <= 8) {
+                values[count++] = _pext_u64(word, payloadBits >> (64 - 8 * length));
+                offset = next;
+                continue;
+            }
+            if (length > 10) {
+                break;
+            }
+            const auto high = _pext_u32(LE::toInt<std::uint16_t>(current + offset + 8), 0x7F7Fu >> (16 - 8 * (length - 8)));
+            if (high > 0xFF) {
+                break;
+            }
+            values[count++] = _pext_u64(word, payloadBits) | (static_cast<std::uint64_t>(high) << 56);
+            offset = next;
+        }
+        current += offset;
+        if (terminators) {
+            break;
+        }
+    }
+    data = current;
+    return count + fromVarUInt64sScalar(data, end, values + count, maxCount - count);
+}
+#endif
+
+/*!
+ * \brief The factor to convert 24-bit PCM values to floats within [-1, 1).
+ */
+constexpr float int24Scale = 1.0f / 8388608.0f;
+
+/*!
+ * \brief Unpacks \a count packed 24-bit samples from \a src into \a dst (sign-extended or normalized to float).
+ */
+template <bool isBigEndian, typename ValueType> inline void unpackInt24Scalar(const char *src, ValueType *dst, std::size_t count)
+{
+    for (auto *const end = dst + count; dst != end; ++dst, src += 3) {
+        const auto unsignedValue = isBigEndian ? BE::toUInt24(src) : LE::toUInt24(src);
+        const auto value = static_cast<std::int32_t>(unsignedValue ^ 0x800000u) - 0x800000;
+        if constexpr (std::is_same_v<ValueType, float>) {
+            *dst = static_cast<float>(value) * int24Scale;
+        } else {
+            *dst = value;
+        }
+    }
+}
+
+/*!
+ * \brief Returns the 24-bit PCM value for the specified normalized \a sample clamping it to the range of 24-bit integers.
+ * \remarks Rounds to nearest (even) like the SIMD kernels and maps NaN to the minimum.
+ */
+inline std::int32_t int24FromFloat(float sample)
+{
+    auto value = sample * 8388608.0f;
+    value = value >= -8388608.0f ? value : -8388608.0f;
+    value = value <= 8388607.0f ? value : 8388607.0f;
+    return static_cast<std::int32_t>(std::nearbyint(value));
+}
+
+/*!
+ * \brief Packs \a count samples from \a src as 24-bit samples into \a dst discarding the most significant byte of integers.
+ */
+template <bool isBigEndian, typename ValueType> inline void packInt24Scalar(const ValueType *src, char *dst, std::size_t count)
+{
+    for (const auto *const end = src + count; src != end; ++src, dst += 3) {
+        auto value = std::int32_t();
+        if constexpr (std::is_same_v<ValueType, float>) {
+            value = int24FromFloat(*src);
+        } else {
+            value = *src;
+        }
+        if constexpr (isBigEndian) {
+            BE::getBytes24(static_cast<std::uint32_t>(value), dst);
+        } else {
+            LE::getBytes24(static_cast<std::uint32_t>(value), dst);
+        }
+    }
+}
+
+#ifdef CPP_UTILITIES_X86_DISPATCH
+/*!
+ * \brief Returns the shuffle mask to move four packed 24-bit samples into the upper three bytes of 32-bit lanes.
+ */
+template <bool isBigEndian> CPP_UTILITIES_TARGET("ssse3") inline __m128i unpackInt24Mask()
+{
+    if constexpr (isBigEndian) {
+        return _mm_setr_epi8(-1, 2, 1, 0, -1, 5, 4, 3, -1, 8, 7, 6, -1, 11, 10, 9);
+    } else {
+        return _mm_setr_epi8(-1, 0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11);
+    }
+}
+
+/*!
+ * \brief Returns the shuffle mask to move the lower three bytes of four 32-bit lanes into 12 packed bytes.
+ */
+template <bool isBigEndian> CPP_UTILITIES_TARGET("ssse3") inline __m128i packInt24Mask()
+{
+    if constexpr (isBigEndian) {
+        return _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1);
+    } else {
+        return _mm_setr_epi8(0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, -1, -1, -1, -1);
+    }
+}
+
+template <bool isBigEndian, typename ValueType> CPP_UTILITIES_TARGET("ssse3") void unpackInt24Ssse3(const char *src, ValueType *dst, std::size_t count)
+{
+    const auto mask = unpackInt24Mask<isBigEndian>();
+    const auto scale = _mm_set1_ps(int24Scale);
+    // process 4 samples (12 bytes) per iteration; loading 16 bytes requires at least 6 samples to be left
+    for (; count >= 6; count -= 4, src += 12, dst += 4) {
+        const auto values = _mm_srai_epi32(_mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i *>(src)), mask), 8);
+        if constexpr (std::is_same_v<ValueType, float>) {
+            _mm_storeu_ps(dst, _mm_mul_ps(_mm_cvtepi32_ps(values), scale));
+        } else {
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(dst), values);
+        }
+    }
+    unpackInt24Scalar<isBigEndian>(src, dst, count);
+}
+
+template <bool isBigEndian, typename ValueType> CPP_UTILITIES_TARGET("avx2") void unpackInt24Avx2(const char *src, ValueType *dst, std::size_t count)
+{
+    const auto mask = _mm256_broadcastsi128_si256(unpackInt24Mask<isBigEndian>());
+    const auto scale = _mm256_set1_ps(int24Scale);
+    // process 8 samples (24 bytes) per iteration via two overlapping 16-byte loads; requires at least 10 samples to be left
+    for (; count >= 10; count -= 8, src += 24, dst += 8) {
+        const auto low = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src));
+        const auto high = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + 12));
+        const auto values = _mm256_srai_epi32(_mm256_shuffle_epi8(_mm256_inserti128_si256(_mm256_castsi128_si256(low), high, 1), mask), 8);
+        if constexpr (std::is_same_v<ValueType, float>) {
+            _mm256_storeu_ps(dst, _mm256_mul_ps(_mm256_cvtepi32_ps(values), scale));
+        } else {
+            _mm256_storeu_si256(reinterpret_cast<__m256i *>(dst), values);
+        }
+    }
+    unpackInt24Ssse3<isBigEndian>(src, dst, count);
+}
+
+template <bool isBigEndian, typename ValueType> CPP_UTILITIES_TARGET("ssse3") void packInt24Ssse3(const ValueType *src, char *dst, std::size_t count)
+{
+    const auto mask = packInt24Mask<isBigEndian>();
+    const auto scale = _mm_set1_ps(8388608.0f), min = _mm_set1_ps(-8388608.0f), max = _mm_set1_ps(8388607.0f);
+    // process 4 samples per iteration; storing 16 bytes requires at least 6 samples to be left
+    for (; count >= 6; count -= 4, src += 4, dst += 12) {
+        auto values = __m128i();
+        if constexpr (std::is_same_v<ValueType, float>) {
+            values = _mm_cvtps_epi32(_mm_min_ps(_mm_max_ps(_mm_mul_ps(_mm_loadu_ps(src), scale), min), max));
+        } else {
+            values = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src));
+        }
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dst), _mm_shuffle_epi8(values, mask));
+    }
+    packInt24Scalar<isBigEndian>(src, dst, count);
+}
+
+template <bool isBigEndian, typename ValueType> CPP_UTILITIES_TARGET("avx2") void packInt24Avx2(const ValueType *src, char *dst, std::size_t count)
+{
+    const auto mask = _mm256_broadcastsi128_si256(packInt24Mask<isBigEndian>());
+    const auto scale = _mm256_set1_ps(8388608.0f), min = _mm256_set1_ps(-8388608.0f), max = _mm256_set1_ps(8388607.0f);
+    // process 8 samples per iteration via two overlapping 16-byte stores; requires at least 10 samples to be left
+    for (; count >= 10; count -= 8, src += 8, dst += 24) {
+        auto values = __m256i();
+        if constexpr (std::is_same_v<ValueType, float>) {
+            values = _mm256_cvtps_epi32(_mm256_min_ps(_mm256_max_ps(_mm256_mul_ps(_mm256_loadu_ps(src), scale), min), max));
+        } else {
+            values = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(src));
+        }
+        const auto packed = _mm256_shuffle_epi8(values, mask);
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dst), _mm256_castsi256_si128(packed));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + 12), _mm256_extracti128_si256(packed, 1));
+    }
+    packInt24Ssse3<isBigEndian>(src, dst, count);
+}
+#endif
+
+/*!
+ * \brief Unpacks 24-bit samples using the best kernel the CPU supports.
+ */
+template <bool isBigEndian, typename ValueType> void unpackInt24(const char *src, ValueType *dst, std::size_t count)
+{
+#ifdef CPP_UTILITIES_X86_DISPATCH
+    if (CpuFeatures::hasAvx2()) {
+        unpackInt24Avx2<isBigEndian>(src, dst, count);
+        return;
+    }
+    if (CpuFeatures::hasSsse3()) {
+        unpackInt24Ssse3<isBigEndian>(src, dst, count);
+        return;
+    }
+#endif
+    unpackInt24Scalar<isBigEndian>(src, dst, count);
+}
+
+/*!
+ * \brief Packs 24-bit samples using the best kernel the CPU supports.
+ */
+template <bool isBigEndian, typename ValueType> void packInt24(const ValueType *src, char *dst, std::size_t count)
+{
+#ifdef CPP_UTILITIES_X86_DISPATCH
+    if (CpuFeatures::hasAvx2()) {
+        packInt24Avx2<isBigEndian>(src, dst, count);
+        return;
+    }
+    if (CpuFeatures::hasSsse3()) {
+        packInt24Ssse3<isBigEndian>(src, dst, count);
+        return;
+    }
+#endif
+    packInt24Scalar<isBigEndian>(src, dst, count);
+}
+
+/*!
+ * \brief Unpacks \a count packed 24-bit samples from \a src into \a dst sign-extending them.
+ */
+void unpackInt24(const char *src, std::int32_t *dst, std::size_t count, bool isBigEndian)
+{
+    isBigEndian ? unpackInt24<true>(src, dst, count) : unpackInt24<false>(src, dst, count);
+}
+
+/*!
+ * \brief Unpacks \a count packed 24-bit samples from \a src into \a dst normalizing them to [-1, 1).
+ */
+void unpackInt24(const char *src, float *dst, std::size_t count, bool isBigEndian)
+{
+    isBigEndian ? unpackInt24<true>(src, dst, count) : unpackInt24<false>(src, dst, count);
+}
+
+/*!
+ * \brief Packs \a count samples from \a src as 24-bit samples into \a dst discarding the most significant byte.
+ */
+void packInt24(const std::int32_t *src, char *dst, std::size_t count, bool isBigEndian)
+{
+    isBigEndian ? packInt24<true>(src, dst, count) : packInt24<false>(src, dst, count);
+}
+
+/*!
+ * \brief Packs \a count normalized samples from \a src as 24-bit samples into \a dst clamping them.
+ */
+void packInt24(const float *src, char *dst, std::size_t count, bool isBigEndian)
+{
+    isBigEndian ? packInt24<true>(src, dst, count) : packInt24<false>(src, dst, count);
+}
+
+/// \brief The maximum scaled value of an 8.8 fixed point representation (as unsigned integer).
+constexpr auto fixed8Max = 65535.0f;
+/// \brief The maximum scaled value of a 16.16 fixed point representation (as unsigned integer) which is representable as float.
+constexpr auto fixed16Max = 4294967040.0f;
+
+/*!
+ * \brief Returns the unsigned 8.8 fixed point representation of \a value truncating it towards zero.
+ * \remarks Values are clamped to [0, 256) like the representation is decoded by toFloat32(). NaN yields zero.
+ */
+inline std::uint16_t toFixed8Scalar(float value)
+{
+    const auto scaled = value * 256.0f;
+    return scaled > 0.0f ? static_cast<std::uint16_t>(std::min(scaled, fixed8Max)) : 0;
+}
+
+/*!
+ * \brief Returns the unsigned 16.16 fixed point representation of \a value truncating it towards zero.
+ * \remarks Values are clamped to [0, 65536) like the representation is decoded by toFloat32(). NaN yields zero.
+ */
+inline std::uint32_t toFixed16Scalar(float value)
+{
+    const auto scaled = value * 65536.0f;
+    return scaled > 0.0f ? static_cast<std::uint32_t>(std::min(scaled, fixed16Max)) : 0;
+}
+
+#ifdef CPP_UTILITIES_X86_DISPATCH
+CPP_UTILITIES_TARGET("avx2") void toFixed8sAvx2(const float *values, std::uint16_t *fixed8values, std::size_t count)
+{
+    const auto scale = _mm256_set1_ps(256.0f), zero = _mm256_setzero_ps(), max = _mm256_set1_ps(fixed8Max);
+    const auto lowHalves = _mm256_setr_epi8(0, 1, 4, 5, 8, 9, 12, 13, -1, -1, -1, -1, -1, -1, -1, -1, 0, 1, 4, 5, 8, 9, 12, 13, -1, -1, -1, -1, -1,
+        -1, -1, -1);
+    for (; count >= 8; count -= 8, values += 8, fixed8values += 8) {
+        // clamp like toFixed8Scalar() does; NaN is turned into zero as _mm256_max_ps() returns its second operand then
+        const auto scaled = _mm256_mul_ps(_mm256_loadu_ps(values), scale);
+        const auto clamped = _mm256_min_ps(_mm256_max_ps(scaled, zero), max);
+        const auto truncated = _mm256_shuffle_epi8(_mm256_cvttps_epi32(clamped), lowHalves);
+        const auto packed = _mm256_permute4x64_epi64(truncated, 0x08);
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(fixed8values), _mm256_castsi256_si128(packed));
+    }
+    for (; count; --count) {
+        *fixed8values++ = toFixed8Scalar(*values++);
+    }
+}
+
+CPP_UTILITIES_TARGET("avx2") void fromFixed8sAvx2(const std::uint16_t *fixed8values, float *values, std::size_t count)
+{
+    const auto scale = _mm256_set1_ps(1.0f / 256.0f);
+    for (; count >= 8; count -= 8, values += 8, fixed8values += 8) {
+        const auto integers = _mm256_cvtepu16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i *>(fixed8values)));
+        _mm256_storeu_ps(values, _mm256_mul_ps(_mm256_cvtepi32_ps(integers), scale));
+    }
+    for (; count; --count) {
+        *values++ = toFloat32(*fixed8values++);
+    }
+}
+
+CPP_UTILITIES_TARGET("avx2") void toFixed16sAvx2(const float *values, std::uint32_t *fixed16values, std::size_t count)
+{
+    const auto scale = _mm256_set1_ps(65536.0f), signBit = _mm256_set1_ps(2147483648.0f);
+    const auto zero = _mm256_setzero_ps(), max = _mm256_set1_ps(fixed16Max);
+    for (; count >= 8; count -= 8, values += 8, fixed16values += 8) {
+        // clamp like toFixed16Scalar() does; NaN is turned into zero as _mm256_max_ps() returns its second operand then
+        const auto scaled = _mm256_min_ps(_mm256_max_ps(_mm256_mul_ps(_mm256_loadu_ps(values), scale), zero), max);
+        // convert values >= 2^31 (which do not fit into a signed integer) by subtracting 2^31 and setting the sign bit afterwards
+        const auto isBig = _mm256_cmp_ps(scaled, signBit, _CMP_GE_OQ);
+        const auto truncated = _mm256_cvttps_epi32(_mm256_sub_ps(scaled, _mm256_and_ps(isBig, signBit)));
+        const auto result = _mm256_xor_si256(truncated, _mm256_slli_epi32(_mm256_castps_si256(isBig), 31));
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(fixed16values), result);
+    }
+    for (; count; --count) {
+        *fixed16values++ = toFixed16Scalar(*values++);
+    }
+}
+
+CPP_UTILITIES_TARGET("avx2") void fromFixed16sAvx2(const std::uint32_t *fixed16values, float *values, std::size_t count)
+{
+    const auto scale = _mm256_set1_ps(1.0f / 65536.0f), highScale = _mm256_set1_ps(65536.0f);
+    const auto lowMask = _mm256_set1_epi32(0xFFFF);
+    for (; count >= 8; count -= 8, values += 8, fixed16values += 8) {
+        // convert the halves separately as only signed integers can be converted; the sum is rounded only once
+        const auto integers = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(fixed16values));
+        const auto high = _mm256_cvtepi32_ps(_mm256_srli_epi32(integers, 16));
+        const auto low = _mm256_cvtepi32_ps(_mm256_and_si256(integers, lowMask));
+        _mm256_storeu_ps(values, _mm256_mul_ps(_mm256_add_ps(_mm256_mul_ps(high, highScale), low), scale));
+    }
+    for (; count; --count) {
+        *values++ = toFloat32(*fixed16values++);
+    }
+}
+
+CPP_UTILITIES_TARGET("avx,f16c") void toFloat16sF16c(const float *values, std::uint16_t *float16values, std::size_t count)
+{
+    for (; count >= 8; count -= 8, values += 8, float16values += 8) {
+        const auto halves = _mm256_cvtps_ph(_mm256_loadu_ps(values), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(float16values), halves);
+    }
+    for (; count; --count) {
+        *float16values++ = toFloat16(*values++);
+    }
+}
+
+CPP_UTILITIES_TARGET("avx,f16c") void fromFloat16sF16c(const std::uint16_t *float16values, float *values, std::size_t count)
+{
+    for (; count >= 8; count -= 8, values += 8, float16values += 8) {
+        _mm256_storeu_ps(values, _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<const __m128i *>(float16values))));
+    }
+    for (; count; --count) {
+        *values++ = fromFloat16(*float16values++);
+    }
+}
+#endif
+
+/*!
+ * \brief Unpacks \a count binary16 values from \a src into \a dst converting the byte order in chunks on the stack if needed.
+ */
+void unpackFloat16(const char *src, float *dst, std::size_t count, bool isBigEndian)
+{
+    constexpr std::size_t chunkSize = 2048;
+    std::uint16_t chunk[chunkSize];
+    for (std::size_t chunkCount; count; count -= chunkCount, src += chunkCount * 2, dst += chunkCount) {
+        chunkCount = std::min(count, chunkSize);
+        if (isBigEndian != CONVERSION_UTILITIES_IS_BYTE_ORDER_BIG_ENDIAN) {
+            swapBytes<2>(src, reinterpret_cast<char *>(chunk), chunkCount);
+        } else {
+            std::memcpy(chunk, src, chunkCount * 2);
+        }
+        fromFloat16s(chunk, dst, chunkCount);
+    }
+}
+
+/*!
+ * \brief Packs \a count values from \a src as binary16 values into \a dst converting the byte order in chunks on the stack if needed.
+ */
+void packFloat16(const float *src, char *dst, std::size_t count, bool isBigEndian)
+{
+    constexpr std::size_t chunkSize = 2048;
+    std::uint16_t chunk[chunkSize];
+    for (std::size_t chunkCount; count; count -= chunkCount, src += chunkCount, dst += chunkCount * 2) {
+        chunkCount = std::min(count, chunkSize);
+        toFloat16s(src, chunk, chunkCount);
+        if (isBigEndian != CONVERSION_UTILITIES_IS_BYTE_ORDER_BIG_ENDIAN) {
+            swapBytes<2>(reinterpret_cast<const char *>(chunk), dst, chunkCount);
+        } else {
+            std::memcpy(dst, chunk, chunkCount * 2);
+        }
+    }
+}
+
+} // namespace Detail
+/// \endcond
+
+/*!
+ * \brief Swaps the byte order of the specified \a count 16-bit unsigned integers in-place.
+ * \remarks Uses SSSE3/AVX2/AVX-512 if supported by the CPU and falls back to swapOrder() for single values otherwise.
+ */
+void swapOrder(std::uint16_t *values, std::size_t count)
+{
+    Detail::swapBytes<2>(reinterpret_cast<const char *>(values), reinterpret_cast<char *>(values), count);
+}
+
+/*!
+ * \brief Swaps the byte order of the specified \a count 16-bit signed integers in-place.
+ * \remarks Uses SSSE3/AVX2/AVX-512 if supported by the CPU and falls back to swapOrder() for single values otherwise.
+ */
+void swapOrder(std::int16_t *values, std::size_t count)
+{
+    Detail::swapBytes<2>(reinterpret_cast<const char *>(values), reinterpret_cast<char *>(values), count);
+}
+
+/*!
+ * \brief Swaps the byte order of the specified \a count 32-bit unsigned integers in-place.
+ * \remarks Uses SSSE3/AVX2/AVX-512 if supported by the CPU and falls back to swapOrder() for single values otherwise.
+ */
+void swapOrder(std::uint32_t *values, std::size_t count)
+{
+    Detail::swapBytes<4>(reinterpret_cast<const char *>(values), reinterpret_cast<char *>(values), count);
+}
+
+/*!
+ * \brief Swaps the byte order of the specified \a count 32-bit signed integers in-place.
+ * \remarks Uses SSSE3/AVX2/AVX-512 if supported by the CPU and falls back to swapOrder() for single values otherwise.
+ */
+void swapOrder(std::int32_t *values, std::size_t count)
+{
+    Detail::swapBytes<4>(reinterpret_cast<const char *>(values), reinterpret_cast<char *>(values), count);
+}
+
+/*!
+ * \brief Swaps the byte order of the specified \a count 64-bit unsigned integers in-place.
+ * \remarks Uses SSSE3/AVX2/AVX-512 if supported by the CPU and falls back to swapOrder() for single values otherwise.
+ */
+void swapOrder(std::uint64_t *values, std::size_t count)
+{
+    Detail::swapBytes<8>(reinterpret_cast<const char *>(values), reinterpret_cast<char *>(values), count);
+}
+
+/*!
+ * \brief Swaps the byte order of the specified \a count 64-bit signed integers in-place.
+ * \remarks Uses SSSE3/AVX2/AVX-512 if supported by the CPU and falls back to swapOrder() for single values otherwise.
+ */
+void swapOrder(std::int64_t *values, std::size_t count)
+{
+    Detail::swapBytes<8>(reinterpret_cast<const char *>(values), reinterpret_cast<char *>(values), count);
+}
+
+/*!
+ * \brief Swaps the byte order of the specified \a count 32-bit floating point numbers in-place.
+ * \remarks Uses SSSE3/AVX2/AVX-512 if supported by the CPU and falls back to swapOrder() for single values otherwise.
+ */
+void swapOrder(float *values, std::size_t count)
+{
+    Detail::swapBytes<4>(reinterpret_cast<const char *>(values), reinterpret_cast<char *>(values), count);
+}
+
+/*!
+ * \brief Swaps the byte order of the specified \a count 64-bit floating point numbers in-place.
+ * \remarks Uses SSSE3/AVX2/AVX-512 if supported by the CPU and falls back to swapOrder() for single values otherwise.
+ */
+void swapOrder(double *values, std::size_t count)
+{
+    Detail::swapBytes<8>(reinterpret_cast<const char *>(values), reinterpret_cast<char *>(values), count);
+}
+
+/*!
+ * \brief Decodes up to \a maxCount LEB128 encoded unsigned integers from \a data to \a end into \a values.
+ *
+ * Decoding stops when \a end is reached. An incomplete integer at the end is not consumed so decoding can be
+ * continued once more data is available.
+ *
+ * \returns Returns the number of integers which have been decoded. \a data is advanced to the end of the last one.
+ * \throws Throws ConversionException if an integer exceeds 64 bit. \a data is left at the begin of that integer.
+ * \remarks Uses SSE2/BMI2 if supported by the CPU to locate the ends of 16 bytes worth of integers at once. The BMI2 kernel
+ *          is not used on AMD CPUs before Zen 3 because PEXT is microcoded there which makes it slower than the scalar code.
+ * \sa toVarUInt64()
+ */
+std::size_t fromVarUInt64s(const char *&data, const char *end, std::uint64_t *values, std::size_t maxCount)
+{
+#ifdef CPP_UTILITIES_X86_DISPATCH
+    if (CpuFeatures::hasFastPext()) {
+        return Detail::fromVarUInt64sBmi2(data, end, values, maxCount);
+    }
+#endif
+    return Detail::fromVarUInt64sScalar(data, end, values, maxCount);
+}
+
+/*!
+ * \brief Converts the specified \a count 32-bit floating point numbers from \a values to 8.8 fixed point representations.
+ * \remarks
+ * - Values are truncated towards zero like toFixed8() does and clamped to the range of the unsigned representation which
+ *   is decoded by fromFixed8s() and toFloat32(). So negative values and NaN yield zero and too big values saturate
+ *   (regardless of whether AVX2 is used).
+ * - Uses AVX2 if supported by the CPU.
+ */
+void toFixed8s(const float *values, std::uint16_t *fixed8values, std::size_t count)
+{
+#ifdef CPP_UTILITIES_X86_DISPATCH
+    if (CpuFeatures::hasAvx2()) {
+        Detail::toFixed8sAvx2(values, fixed8values, count);
+        return;
+    }
+#endif
+    for (const auto *const end = values + count; values != end; ++values, ++fixed8values) {
+        *fixed8values = Detail::toFixed8Scalar(*values);
+    }
+}
+
+/*!
+ * \brief Converts the specified \a count 8.8 fixed point representations from \a fixed8values to 32-bit floating point numbers.
+ * \remarks Uses AVX2 if supported by the CPU.
+ */
+void fromFixed8s(const std::uint16_t *fixed8values, float *values, std::size_t count)
+{
+#ifdef CPP_UTILITIES_X86_DISPATCH
+    if (CpuFeatures::hasAvx2()) {
+        Detail::fromFixed8sAvx2(fixed8values, values, count);
+        return;
+    }
+#endif
+    for (const auto *const end = fixed8values + count; fixed8values != end; ++fixed8values, ++values) {
+        *values = toFloat32(*fixed8values);
+    }
+}
+
+/*!
+ * \brief Converts the specified \a count 32-bit floating point numbers from \a values to 16.16 fixed point representations.
+ * \remarks
+ * - Values are truncated towards zero like toFixed16() does and clamped to the range of the unsigned representation which
+ *   is decoded by fromFixed16s() and toFloat32(). So negative values and NaN yield zero and too big values saturate
+ *   (regardless of whether AVX2 is used).
+ * - Uses AVX2 if supported by the CPU.
+ */
+void toFixed16s(const float *values, std::uint32_t *fixed16values, std::size_t count)
+{
+#ifdef CPP_UTILITIES_X86_DISPATCH
+    if (CpuFeatures::hasAvx2()) {
+        Detail::toFixed16sAvx2(values, fixed16values, count);
+        return;
+    }
+#endif
+    for (const auto *const end = values + count; values != end; ++values, ++fixed16values) {
+        *fixed16values = Detail::toFixed16Scalar(*values);
+    }
+}
+
+/*!
+ * \brief Converts the specified \a count 16.16 fixed point representations from \a fixed16values to 32-bit floating point numbers.
+ * \remarks Uses AVX2 if supported by the CPU.
+ */
+void fromFixed16s(const std::uint32_t *fixed16values, float *values, std::size_t count)
+{
+#ifdef CPP_UTILITIES_X86_DISPATCH
+    if (CpuFeatures::hasAvx2()) {
+        Detail::fromFixed16sAvx2(fixed16values, values, count);
+        return;
+    }
+#endif
+    for (const auto *const end = fixed16values + count; fixed16values != end; ++fixed16values, ++values) {
+        *values = toFloat32(*fixed16values);
+    }
+}
+
+/*!
+ * \brief Converts the specified \a count 32-bit floating point numbers from \a values to IEEE-754 binary16 representations.
+ * \remarks Uses F16C if supported by the CPU; otherwise toFloat16() is used which yields the same results.
+ */
+void toFloat16s(const float *values, std::uint16_t *float16values, std::size_t count)
+{
+#ifdef CPP_UTILITIES_X86_DISPATCH
+    if (CpuFeatures::hasF16c()) {
+        Detail::toFloat16sF16c(values, float16values, count);
+        return;
+    }
+#endif
+    for (const auto *const end = values + count; values != end; ++values, ++float16values) {
+        *float16values = toFloat16(*values);
+    }
+}
+
+/*!
+ * \brief Converts the specified \a count IEEE-754 binary16 representations from \a float16values to 32-bit floating point numbers.
+ * \remarks Uses F16C if supported by the CPU; otherwise fromFloat16() is used which yields the same results.
+ */
+void fromFloat16s(const std::uint16_t *float16values, float *values, std::size_t count)
+{
+#ifdef CPP_UTILITIES_X86_DISPATCH
+    if (CpuFeatures::hasF16c()) {
+        Detail::fromFloat16sF16c(float16values, values, count);
+        return;
+    }
+#endif
+    for (const auto *const end = float16values + count; float16values != end; ++float16values, ++values) {
+        *values = fromFloat16(*float16values);
+    }
+}
+
+} // namespace CppUtilities
@@ -4,6 +4,7 @@
 #include "../global.h"
 #include "../misc/traits.h"
 
+#include <cstddef>
 #include <cstdint>
 #include <cstring>
 
@@ -112,6 +113,71 @@ CPP_UTILITIES_EXPORT constexpr float toFloat32(std::uint32_t fixed16value)
     return static_cast<float>(fixed16value) / 65536.0f;
 }
 
+/*!
+ * \brief Returns the IEEE-754 binary16 (half-precision) representation of the specified 32-bit floating point number.
+ * \remarks
+ * - Rounds to nearest (even); values exceeding the range of binary16 become infinity.
+ * - NaN stays NaN (quiet) keeping the upper bits of its payload like the F16C instruction set does.
+ */
+CPP_UTILITIES_EXPORT inline std::uint16_t toFloat16(float float32value)
+{
+    auto bits = std::uint32_t();
+    std::memcpy(&bits, &float32value, sizeof(bits));
+    const auto sign = static_cast<std::uint16_t>((bits >> 16) & 0x8000u);
+    bits &= 0x7FFFFFFFu;
+    if (bits >= 0x47800000u) {
+        // infinity/NaN or beyond the range of binary16 (>= 2^16)
+        return static_cast<std::uint16_t>(sign | (bits > 0x7F800000u ? 0x7E00u | ((bits >> 13) & 0x3FFu) : 0x7C00u));
+    }
+    if (bits < 0x38800000u) {
+        // subnormal or zero (< 2^-14); let the FPU do the rounding by adding a value whose ULP matches the binary16 subnormal ULP
+        constexpr auto magicBits = std::uint32_t(126) << 23;
+        auto magic = float();
+        std::memcpy(&magic, &magicBits, sizeof(magic));
+        auto value = float();
+        std::memcpy(&value, &bits, sizeof(value));
+        value += magic;
+        std::memcpy(&bits, &value, sizeof(bits));
+        return static_cast<std::uint16_t>(sign | (bits - magicBits));
+    }
+    // normal number; adjust the exponent bias and round to nearest even (a carry into the exponent is intended)
+    const auto isMantissaOdd = (bits >> 13) & 1u;
+    bits += 0xC8000FFFu + isMantissaOdd;
+    return static_cast<std::uint16_t>(sign | (bits >> 13));
+}
+
+/*!
+ * \brief Returns the 32-bit floating point number converted from the specified IEEE-754 binary16 (half-precision) representation.
+ * \remarks The conversion is exact; signaling NaNs are quieted like the F16C instruction set does.
+ */
+CPP_UTILITIES_EXPORT inline float fromFloat16(std::uint16_t float16value)
+{
+    constexpr auto shiftedExponent = std::uint32_t(0x7C00) << 13;
+    auto bits = static_cast<std::uint32_t>(float16value & 0x7FFFu) << 13;
+    const auto exponent = bits & shiftedExponent;
+    bits += std::uint32_t(127 - 15) << 23;
+    auto value = float();
+    if (exponent == shiftedExponent) {
+        // infinity/NaN
+        bits += std::uint32_t(128 - 16) << 23;
+        if (bits & 0x7FFFFFu) {
+            bits |= 0x400000u;
+        }
+        std::memcpy(&value, &bits, sizeof(value));
+    } else if (!exponent) {
+        // zero/subnormal; renormalize via the FPU
+        constexpr auto magicBits = std::uint32_t(113) << 23;
+        auto magic = float();
+        std::memcpy(&magic, &magicBits, sizeof(magic));
+        bits += std::uint32_t(1) << 23;
+        std::memcpy(&value, &bits, sizeof(value));
+        value -= magic;
+    } else {
+        std::memcpy(&value, &bits, sizeof(value));
+    }
+    return (float16value & 0x8000u) ? -value : value;
+}
+
 /*!
  * \brief Returns a 32-bit synchsafe integer converted from a normal 32-bit integer.
  * \remarks Synchsafe integers appear in ID3 tags that are attached to an MP3 file.
@@ -133,6 +199,40 @@ CPP_UTILITIES_EXPORT constexpr std::uint32_t toNormalInt(std::uint32_t synchsafe
         | ((synchsafeInt & 0x7f000000u) >> 3);
 }
 
+/*!
+ * \brief Maps the specified signed integer to an unsigned integer so that values of small magnitude result in small values.
+ * \remarks ZigZag encoding maps 0, -1, 1, -2, 2, ... to 0, 1, 2, 3, 4, ... and is used to encode signed integers as LEB128.
+ * \sa <a href="https://protobuf.dev/programming-guides/encoding/#signed-ints">Protocol Buffers - Signed Integers</a>
+ */
+CPP_UTILITIES_EXPORT constexpr std::uint64_t toZigZagInt(std::int64_t signedInt)
+{
+    return (static_cast<std::uint64_t>(signedInt) << 1) ^ static_cast<std::uint64_t>(signedInt >> 63);
+}
+
+/*!
+ * \brief Returns the signed integer the specified ZigZag encoded integer represents.
+ * \sa toZigZagInt()
+ */
+CPP_UTILITIES_EXPORT constexpr std::int64_t fromZigZagInt(std::uint64_t zigZagInt)
+{
+    return static_cast<std::int64_t>((zigZagInt >> 1) ^ (~(zigZagInt & 1) + 1));
+}
+
+/*!
+ * \brief Encodes the specified \a value as LEB128 writing up to 10 bytes to \a buffer.
+ * \returns Returns the number of bytes written.
+ * \sa <a href="https://en.wikipedia.org/wiki/LEB128">LEB128 - Wikipedia</a>
+ */
+inline std::size_t toVarUInt64(std::uint64_t value, char *buffer)
+{
+    auto *current = buffer;
+    for (; value >= 0x80; value >>= 7) {
+        *current++ = static_cast<char>((value & 0x7F) | 0x80);
+    }
+    *current++ = static_cast<char>(value);
+    return static_cast<std::size_t>(current - buffer);
+}
+
 // define helpers for byte swapping
 #ifdef __cpp_lib_byteswap // in C++ 23 we can just use the stdlib
 template <class T, Traits::EnableIf<std::is_integral<T>> * = nullptr> CPP_UTILITIES_EXPORT constexpr T swapOrder(T value)
@@ -200,6 +300,34 @@ CPP_UTILITIES_EXPORT constexpr std::int64_t swapOrder(std::int64_t value)
 }
 #endif
 
+CPP_UTILITIES_EXPORT void swapOrder(std::uint16_t *values, std::size_t count);
+CPP_UTILITIES_EXPORT void swapOrder(std::int16_t *values, std::size_t count);
+CPP_UTILITIES_EXPORT void swapOrder(std::uint32_t *values, std::size_t count);
+CPP_UTILITIES_EXPORT void swapOrder(std::int32_t *values, std::size_t count);
+CPP_UTILITIES_EXPORT void swapOrder(std::uint64_t *values, std::size_t count);
+CPP_UTILITIES_EXPORT void swapOrder(std::int64_t *values, std::size_t count);
+CPP_UTILITIES_EXPORT void swapOrder(float *values, std::size_t count);
+CPP_UTILITIES_EXPORT void swapOrder(double *values, std::size_t count);
+CPP_UTILITIES_EXPORT std::size_t fromVarUInt64s(const char *&data, const char *end, std::uint64_t *values, std::size_t maxCount);
+CPP_UTILITIES_EXPORT void toFixed8s(const float *values, std::uint16_t *fixed8values, std::size_t count);
+CPP_UTILITIES_EXPORT void fromFixed8s(const std::uint16_t *fixed8values, float *values, std::size_t count);
+CPP_UTILITIES_EXPORT void toFixed16s(const float *values, std::uint32_t *fixed16values, std::size_t count);
+CPP_UTILITIES_EXPORT void fromFixed16s(const std::uint32_t *fixed16values, float *values, std::size_t count);
+CPP_UTILITIES_EXPORT void toFloat16s(const float *values, std::uint16_t *float16values, std::size_t count);
+CPP_UTILITIES_EXPORT void fromFloat16s(const std::uint16_t *float16values, float *values, std::size_t count);
+
+/// \cond
+namespace Detail {
+CPP_UTILITIES_EXPORT void copyWithSwappedOrder(const char *src, char *dst, std::size_t count, std::size_t width);
+CPP_UTILITIES_EXPORT void unpackInt24(const char *src, std::int32_t *dst, std::size_t count, bool isBigEndian);
+CPP_UTILITIES_EXPORT void unpackInt24(const char *src, float *dst, std::size_t count, bool isBigEndian);
+CPP_UTILITIES_EXPORT void packInt24(const std::int32_t *src, char *dst, std::size_t count, bool isBigEndian);
+CPP_UTILITIES_EXPORT void packInt24(const float *src, char *dst, std::size_t count, bool isBigEndian);
+CPP_UTILITIES_EXPORT void unpackFloat16(const char *src, float *dst, std::size_t count, bool isBigEndian);
+CPP_UTILITIES_EXPORT void packFloat16(const float *src, char *dst, std::size_t count, bool isBigEndian);
+} // namespace Detail
+/// \endcond
+
 /*!
  * \brief Encapsulates binary conversion functions using the big endian byte order.
  * \sa <a href="http://en.wikipedia.org/wiki/Endianness">Endianness - Wikipedia</a>
@@ -202,6 +202,247 @@ CPP_UTILITIES_EXPORT inline void getBytes(double value, char *outputbuffer)
     getBytes(i, outputbuffer);
 }
 
+/// \cond
+/*!
+ * \brief Copies \a count values of type \a T from \a src to \a dst converting between the byte order of this namespace
+ *        and the host byte order.
+ */
+template <typename T> inline void convertValues(const char *src, char *dst, std::size_t count)
+{
+#if CONVERSION_UTILITIES_BINARY_CONVERSION_INTERNAL == 0
+    constexpr auto needsSwap = !CONVERSION_UTILITIES_IS_BYTE_ORDER_BIG_ENDIAN;
+#else
+    constexpr auto needsSwap = CONVERSION_UTILITIES_IS_BYTE_ORDER_BIG_ENDIAN;
+#endif
+    if constexpr (needsSwap) {
+        Detail::copyWithSwappedOrder(src, dst, count, sizeof(T));
+    } else if (count) {
+        std::memcpy(dst, src, count * sizeof(T));
+    }
+}
+/// \endcond
+
+/*!
+ * \brief Converts \a count 16-bit signed integers from the specified char array into \a values.
+ * \remarks Uses SSSE3/AVX2/AVX-512 if supported by the CPU to convert the byte order of many values at once.
+ */
+CPP_UTILITIES_EXPORT inline void toInt16s(const char *value, std::int16_t *values, std::size_t count)
+{
+    convertValues<std::int16_t>(value, reinterpret_cast<char *>(values), count);
+}
+
+/*!
+ * \brief Converts \a count 16-bit unsigned integers from the specified char array into \a values.
+ * \remarks Uses SSSE3/AVX2/AVX-512 if supported by the CPU to convert the byte order of many values at once.
+ */
+CPP_UTILITIES_EXPORT inline void toUInt16s(const char *value, std::uint16_t *values, std::size_t count)
+{
+    convertValues<std::uint16_t>(value, reinterpret_cast<char *>(values), count);
+}
+
+/*!
+ * \brief Converts \a count 32-bit signed integers from the specified char array into \a values.
+ * \remarks Uses SSSE3/AVX2/AVX-512 if supported by the CPU to convert the byte order of many values at once.
+ */
+CPP_UTILITIES_EXPORT inline void toInt32s(const char *value, std::int32_t *values, std::size_t count)
+{
+    convertValues<std::int32_t>(value, reinterpret_cast<char *>(values), count);
+}
+
+/*!
+ * \brief Converts \a count 32-bit unsigned integers from the specified char array into \a values.
+ * \remarks Uses SSSE3/AVX2/AVX-512 if supported by the CPU to convert the byte order of many values at once.
+ */
+CPP_UTILITIES_EXPORT inline void toUInt32s(const char *value, std::uint32_t *values, std::size_t count)
+{
+    convertValues<std::uint32_t>(value, reinterpret_cast<char *>(values), count);
+}
+
+/*!
+ * \brief Converts \a count 64-bit signed integers from the specified char array into \a values.
+ * \remarks Uses SSSE3/AVX2/AVX-512 if supported by the CPU to convert the byte order of many values at once.
+ */
+CPP_UTILITIES_EXPORT inline void toInt64s(const char *value, std::int64_t *values, std::size_t count)
+{
+    convertValues<std::int64_t>(value, reinterpret_cast<char *>(values), count);
+}
+
+/*!
+ * \brief Converts \a count 64-bit unsigned integers from the specified char array into \a values.
+ * \remarks Uses SSSE3/AVX2/AVX-512 if supported by the CPU to convert the byte order of many values at once.
+ */
+CPP_UTILITIES_EXPORT inline void toUInt64s(const char *value, std::uint64_t *values, std::size_t count)
+{
+    convertValues<std::uint64_t>(value, reinterpret_cast<char *>(values), count);
+}
+
+/*!
+ * \brief Converts \a count 32-bit floating point numbers from the specified char array into \a values.
+ * \remarks Uses SSSE3/AVX2/AVX-512 if supported by the CPU to convert the byte order of many values at once.
+ */
+CPP_UTILITIES_EXPORT inline void toFloat32s(const char *value, float *values, std::size_t count)
+{
+    convertValues<float>(value, reinterpret_cast<char *>(values), count);
+}
+
+/*!
+ * \brief Converts \a count 64-bit floating point numbers from the specified char array into \a values.
+ * \remarks Uses SSSE3/AVX2/AVX-512 if supported by the CPU to convert the byte order of many values at once.
+ */
+CPP_UTILITIES_EXPORT inline void toFloat64s(const char *value, double *values, std::size_t count)
+{
+    convertValues<double>(value, reinterpret_cast<char *>(values), count);
+}
+
+/*!
+ * \brief Stores the specified \a count 16-bit signed integers from \a values in a char array.
+ * \remarks Uses SSSE3/AVX2/AVX-512 if supported by the CPU to convert the byte order of many values at once.
+ */
+CPP_UTILITIES_EXPORT inline void getBytes(const std::int16_t *values, std::size_t count, char *outputbuffer)
+{
+    convertValues<std::int16_t>(reinterpret_cast<const char *>(values), outputbuffer, count);
+}
+
+/*!
+ * \brief Stores the specified \a count 16-bit unsigned integers from \a values in a char array.
+ * \remarks Uses SSSE3/AVX2/AVX-512 if supported by the CPU to convert the byte order of many values at once.
+ */
+CPP_UTILITIES_EXPORT inline void getBytes(const std::uint16_t *values, std::size_t count, char *outputbuffer)
+{
+    convertValues<std::uint16_t>(reinterpret_cast<const char *>(values), outputbuffer, count);
+}
+
+/*!
+ * \brief Stores the specified \a count 32-bit signed integers from \a values in a char array.
+ * \remarks Uses SSSE3/AVX2/AVX-512 if supported by the CPU to convert the byte order of many values at once.
+ */
+CPP_UTILITIES_EXPORT inline void getBytes(const std::int32_t *values, std::size_t count, char *outputbuffer)
+{
+    convertValues<std::int32_t>(reinterpret_cast<const char *>(values), outputbuffer, count);
+}
+
+/*!
+ * \brief Stores the specified \a count 32-bit unsigned integers from \a values in a char array.
+ * \remarks Uses SSSE3/AVX2/AVX-512 if supported by the CPU to convert the byte order of many values at once.
+ */
+CPP_UTILITIES_EXPORT inline void getBytes(const std::uint32_t *values, std::size_t count, char *outputbuffer)
+{
+    convertValues<std::uint32_t>(reinterpret_cast<const char *>(values), outputbuffer, count);
+}
+
+/*!
+ * \brief Stores the specified \a count 64-bit signed integers from \a values in a char array.
+ * \remarks Uses SSSE3/AVX2/AVX-512 if supported by the CPU to convert the byte order of many values at once.
+ */
+CPP_UTILITIES_EXPORT inline void getBytes(const std::int64_t *values, std::size_t count, char *outputbuffer)
+{
+    convertValues<std::int64_t>(reinterpret_cast<const char *>(values), outputbuffer, count);
+}
+
+/*!
+ * \brief Stores the specified \a count 64-bit unsigned integers from \a values in a char array.
+ * \remarks Uses SSSE3/AVX2/AVX-512 if supported by the CPU to convert the byte order of many values at once.
+ */
+CPP_UTILITIES_EXPORT inline void getBytes(const std::uint64_t *values, std::size_t count, char *outputbuffer)
+{
+    convertValues<std::uint64_t>(reinterpret_cast<const char *>(values), outputbuffer, count);
+}
+
+/*!
+ * \brief Stores the specified \a count 32-bit floating point numbers from \a values in a char array.
+ * \remarks Uses SSSE3/AVX2/AVX-512 if supported by the CPU to convert the byte order of many values at once.
+ */
+CPP_UTILITIES_EXPORT inline void getBytes(const float *values, std::size_t count, char *outputbuffer)
+{
+    convertValues<float>(reinterpret_cast<const char *>(values), outputbuffer, count);
+}
+
+/*!
+ * \brief Stores the specified \a count 64-bit floating point numbers from \a values in a char array.
+ * \remarks Uses SSSE3/AVX2/AVX-512 if supported by the CPU to convert the byte order of many values at once.
+ */
+CPP_UTILITIES_EXPORT inline void getBytes(const double *values, std::size_t count, char *outputbuffer)
+{
+    convertValues<double>(reinterpret_cast<const char *>(values), outputbuffer, count);
+}
+
+/*!
+ * \brief Converts \a count packed 24-bit signed integers (e.g. PCM samples) from the specified char array into \a values.
+ * \remarks Uses SSSE3/AVX2 if supported by the CPU to sign-extend many values at once.
+ */
+CPP_UTILITIES_EXPORT inline void toInt24s(const char *value, std::int32_t *values, std::size_t count)
+{
+    Detail::unpackInt24(value, values, count, CONVERSION_UTILITIES_BINARY_CONVERSION_INTERNAL == 0);
+}
+
+/*!
+ * \brief Converts \a count packed 24-bit signed integers (e.g. PCM samples) from the specified char array into \a values
+ *        normalized to [-1, 1).
+ * \remarks Uses SSSE3/AVX2 if supported by the CPU to convert many values at once.
+ */
+CPP_UTILITIES_EXPORT inline void toInt24s(const char *value, float *values, std::size_t count)
+{
+    Detail::unpackInt24(value, values, count, CONVERSION_UTILITIES_BINARY_CONVERSION_INTERNAL == 0);
+}
+
+/*!
+ * \brief Stores the specified \a count integers from \a values as packed 24-bit integers in a char array.
+ * \remarks Ignores the most significant byte of each value (like getBytes24() for a single value). Uses SSSE3/AVX2 if
+ *          supported by the CPU to convert many values at once.
+ */
+CPP_UTILITIES_EXPORT inline void getBytes24(const std::int32_t *values, std::size_t count, char *outputbuffer)
+{
+    Detail::packInt24(values, outputbuffer, count, CONVERSION_UTILITIES_BINARY_CONVERSION_INTERNAL == 0);
+}
+
+/*!
+ * \brief Stores the specified \a count normalized samples from \a values as packed 24-bit integers in a char array.
+ * \remarks Values are scaled by 2^23, rounded to nearest and clamped to the range of 24-bit integers. Uses SSSE3/AVX2 if
+ *          supported by the CPU to convert many values at once.
+ */
+CPP_UTILITIES_EXPORT inline void getBytes24(const float *values, std::size_t count, char *outputbuffer)
+{
+    Detail::packInt24(values, outputbuffer, count, CONVERSION_UTILITIES_BINARY_CONVERSION_INTERNAL == 0);
+}
+
+/*!
+ * \brief Returns a 32-bit floating point number converted from the IEEE-754 binary16 (half-precision) number stored in two
+ *        bytes at a specified position in a char array.
+ */
+CPP_UTILITIES_EXPORT inline float toFloat16(const char *value)
+{
+    return fromFloat16(toInt<std::uint16_t>(value));
+}
+
+/*!
+ * \brief Converts \a count IEEE-754 binary16 (half-precision) numbers from the specified char array into \a values.
+ * \remarks Uses F16C if supported by the CPU to convert many values at once.
+ */
+CPP_UTILITIES_EXPORT inline void toFloat16s(const char *value, float *values, std::size_t count)
+{
+    Detail::unpackFloat16(value, values, count, CONVERSION_UTILITIES_BINARY_CONVERSION_INTERNAL == 0);
+}
+
+/*!
+ * \brief Stores the specified 32-bit floating point value as IEEE-754 binary16 (half-precision) number at a specified
+ *        position in a char array.
+ * \remarks Rounds to nearest (even); see CppUtilities::toFloat16(float) for details.
+ */
+CPP_UTILITIES_EXPORT inline void getFloat16Bytes(float value, char *outputbuffer)
+{
+    getBytes(CppUtilities::toFloat16(value), outputbuffer);
+}
+
+/*!
+ * \brief Stores the specified \a count 32-bit floating point values from \a values as IEEE-754 binary16 (half-precision)
+ *        numbers in a char array.
+ * \remarks Uses F16C if supported by the CPU to convert many values at once.
+ */
+CPP_UTILITIES_EXPORT inline void getFloat16Bytes(const float *values, std::size_t count, char *outputbuffer)
+{
+    Detail::packFloat16(values, outputbuffer, count, CONVERSION_UTILITIES_BINARY_CONVERSION_INTERNAL == 0);
+}
+
 #ifdef __GNUC__
 #pragma GCC diagnostic pop
 #endif
@@ -0,0 +1,445 @@
+#include "./asyncfilereader.h"
+#include "./readatprivate.h"
+
+#include <algorithm>
+#include <exception>
+#include <ios>
+
+#if defined(PLATFORM_LINUX) && defined(__has_include) && !defined(CPP_UTILITIES_NO_IO_URING)
+#if __has_include(<linux/io_uring.h>)
+#define CPP_UTILITIES_USE_IO_URING
+#include <cstring>
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#include <unistd.h>
+#endif
+#endif
+
+using namespace std;
+
+namespace CppUtilities {
+
+/// \cond
+namespace Detail {
+
+#ifdef CPP_UTILITIES_USE_IO_URING
+/*!
+ * \brief The IoUring struct holds an io_uring instance and the memory mappings of its queues.
+ * \remarks The system calls are used directly to avoid a dependency on liburing.
+ */
+struct IoUring {
+    ~IoUring();
+    static std::unique_ptr<IoUring> create(unsigned int entries);
+    unsigned int enter(unsigned int toSubmit, unsigned int minComplete);
+
+    int fd = -1;
+    unsigned int entries = 0;
+    void *submissionRing = MAP_FAILED;
+    std::size_t submissionRingSize = 0;
+    void *completionRing = MAP_FAILED;
+    std::size_t completionRingSize = 0;
+    io_uring_sqe *submissionEntries = static_cast<io_uring_sqe *>(MAP_FAILED);
+    std::size_t submissionEntriesSize = 0;
+    unsigned int *submissionHead = nullptr;
+    unsigned int *submissionTail = nullptr;
+    unsigned int *submissionMask = nullptr;
+    unsigned int *submissionArray = nullptr;
+    unsigned int *completionHead = nullptr;
+    unsigned int *completionTail = nullptr;
+    unsigned int *completionMask = nullptr;
+    io_uring_cqe *completionEntries = nullptr;
+};
+
+/*!
+ * \brief Unmaps the queues and closes the io_uring instance.
+ */
+IoUring::~IoUring()
+{
+    if (submissionEntries != MAP_FAILED) {
+        munmap(submissionEntries, submissionEntriesSize);
+    }
+    if (completionRing != MAP_FAILED && completionRing != submissionRing) {
+        munmap(completionRing, completionRingSize);
+    }
+    if (submissionRing != MAP_FAILED) {
+        munmap(submissionRing, submissionRingSize);
+    }
+    if (fd != -1) {
+        ::close(fd);
+    }
+}
+
+/*!
+ * \brief Creates an io_uring instance with (at least) the specified number of \a entries.
+ * \returns Returns nullptr if io_uring is not supported (e.g. by the kernel or because it is disabled via seccomp).
+ */
+std::unique_ptr<IoUring> IoUring::create(unsigned int entries)
+{
+    auto params = io_uring_params();
+    std::memset(&params, 0, sizeof(params));
+    auto ring = std::make_unique<IoUring>();
+    ring->fd = static_cast<int>(syscall(__NR_io_uring_setup, entries, &params));
+    if (ring->fd < 0) {
+        ring->fd = -1;
+        return nullptr;
+    }
+    ring->entries = params.sq_entries;
+    ring->submissionRingSize = params.sq_off.array + params.sq_entries * sizeof(unsigned int);
+    ring->completionRingSize = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+    if (params.features & IORING_FEAT_SINGLE_MMAP) {
+        ring->submissionRingSize = ring->completionRingSize = std::max(ring->submissionRingSize, ring->completionRingSize);
+    }
+    ring->submissionRing = mmap(nullptr, ring->submissionRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring->fd, IORING_OFF_SQ_RING);
+    if (ring->submissionRing == MAP_FAILED) {
+        return nullptr;
+    }
+    if (params.features & IORING_FEAT_SINGLE_MMAP) {
+        ring->completionRing = ring->submissionRing;
+    } else {
+        ring->completionRing
+            = mmap(nullptr, ring->completionRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring->fd, IORING_OFF_CQ_RING);
+        if (ring->completionRing == MAP_FAILED) {
+            return nullptr;
+        }
+    }
+    ring->submissionEntriesSize = params.sq_entries * sizeof(io_uring_sqe);
+    ring->submissionEntries = static_cast<io_uring_sqe *>(
+        mmap(nullptr, ring->submissionEntriesSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring->fd, IORING_OFF_SQES));
+    if (ring->submissionEntries == MAP_FAILED) {
+        return nullptr;
+    }
+    auto *const submissionRing = static_cast<char *>(ring->submissionRing);
+    auto *const completionRing = static_cast<char *>(ring->completionRing);
+    ring->submissionHead = reinterpret_cast<unsigned int *>(submissionRing + params.sq_off.head);
+    ring->submissionTail = reinterpret_cast<unsigned int *>(submissionRing + params.sq_off.tail);
+    ring->submissionMask = reinterpret_cast<unsigned int *>(submissionRing + params.sq_off.ring_mask);
+    ring->submissionArray = reinterpret_cast<unsigned int *>(submissionRing + params.sq_off.array);
+    ring->completionHead = reinterpret_cast<unsigned int *>(completionRing + params.cq_off.head);
+    ring->completionTail = reinterpret_cast<unsigned int *>(completionRing + params.cq_off.tail);
+    ring->completionMask = reinterpret_cast<unsigned int *>(completionRing + params.cq_off.ring_mask);
+    ring->completionEntries = reinterpret_cast<io_uring_cqe *>(completionRing + params.cq_off.cqes);
+    return ring;
+}
+
+/*!
+ * \brief Submits \a toSubmit entries and waits for at least \a minComplete completions.
+ * \returns Returns the number of entries which have been submitted.
+ * \throws Throws std::ios_base::failure if io_uring_enter() fails for another reason than being interrupted or busy.
+ */
+unsigned int IoUring::enter(unsigned int toSubmit, unsigned int minComplete)
+{
+    for (;;) {
+        const auto res = syscall(__NR_io_uring_enter, fd, toSubmit, minComplete, minComplete ? IORING_ENTER_GETEVENTS : 0u, nullptr, 0);
+        if (res >= 0) {
+            return static_cast<unsigned int>(res);
+        }
+        if (errno == EAGAIN || errno == EBUSY) {
+            return 0; // the caller will try to submit the entries again after reaping completions
+        }
+        if (errno != EINTR) {
+            throw std::ios_base::failure("io_uring_enter failed", std::error_code(errno, std::system_category()));
+        }
+    }
+}
+#else
+struct IoUring {
+};
+#endif
+
+} // namespace Detail
+/// \endcond
+
+/*!
+ * \class AsyncFileReader
+ * \brief The AsyncFileReader class executes batches of reads at known offsets of a file asynchronously.
+ *
+ * This is useful when many small reads at random offsets are required, e.g. for reading cue points or box headers
+ * to build a seek index. Instead of executing the reads one after another (as seeking and reading via NativeFileStream
+ * would do) up to queueDepth() reads are executed at the same time so the storage/operating system can reorder and
+ * merge them.
+ *
+ * Under Linux, requests are submitted via io_uring. If io_uring is not available (e.g. the kernel is too old or io_uring
+ * is disabled), the requests are executed via pread() within a pool of up to 32 threads instead. The threads are
+ * only started when needed. The thread pool can also be forced when constructing the AsyncFileReader. The backend in
+ * use can be checked via backend().
+ *
+ * Example:
+ * ```
+ * auto file = NativeFileStream(path, std::ios_base::in | std::ios_base::binary);
+ * auto reader = AsyncFileReader(file);
+ * auto requests = std::vector<AsyncFileReader::Request>();
+ * // ... add requests ...
+ * reader.read(requests, [] (const auto &request, std::size_t bytesRead, const std::error_code &error) {
+ *     // ... process the data at request.buffer ...
+ * });
+ * ```
+ *
+ * \remarks
+ * - The position of the file descriptor is neither used nor altered.
+ * - The object must not be used from multiple threads at the same time.
+ */
+
+/*!
+ * \brief Constructs an AsyncFileReader for the file the specified \a fileDescriptor refers to.
+ * \param fileDescriptor Specifies the file descriptor, e.g. obtained via NativeFileStream::fileDescriptor(). It must
+ *        stay open as long as the AsyncFileReader is used. Ownership is not taken.
+ * \param queueDepth Specifies the maximum number of requests which are executed at the same time.
+ * \param preferredBackend Specifies the backend to use. Backend::IoUring falls back to Backend::ThreadPool if io_uring is
+ *        not available. Backend::ThreadPool forces using the thread pool.
+ */
+AsyncFileReader::AsyncFileReader(int fileDescriptor, std::size_t queueDepth, Backend preferredBackend)
+    : m_fileDescriptor(fileDescriptor)
+    , m_queueDepth(std::clamp<std::size_t>(queueDepth, 1, 4096))
+    , m_stopping(false)
+    , m_simulatedEnterFailures(0)
+{
+#ifdef CPP_UTILITIES_USE_IO_URING
+    if (preferredBackend == Backend::IoUring) {
+        m_ioUring = Detail::IoUring::create(static_cast<unsigned int>(m_queueDepth));
+    }
+#else
+    CPP_UTILITIES_UNUSED(preferredBackend)
+#endif
+}
+
+/*!
+ * \brief Stops the threads of the thread pool (if started) and closes the io_uring instance (if created).
+ */
+AsyncFileReader::~AsyncFileReader()
+{
+    {
+        const auto lock = std::lock_guard(m_mutex);
+        m_stopping = true;
+    }
+    m_requestsAvailable.notify_all();
+    for (auto &thread : m_threads) {
+        thread.join();
+    }
+}
+
+/*!
+ * \brief Executes the specified \a requests invoking \a callback for each of them once completed.
+ *
+ * The function returns once all requests have been completed. The \a callback is invoked within the calling thread in the
+ * order the requests complete (which is not necessarily the order of \a requests). It is passed the request, the number of
+ * bytes which have been read and the error which occurred (if any). Less bytes than requested are only read if the end of
+ * the file has been reached or an error occurred.
+ *
+ * \remarks
+ * - The buffers of the requests must not overlap.
+ * - If \a callback throws an exception, the function still waits for all requests to complete (so buffers are not written
+ *   to anymore) and then rethrows the first exception.
+ * \throws Throws std::ios_base::failure if requests cannot be submitted to io_uring. The function waits for all requests
+ *         which have already been submitted to complete before throwing (without invoking \a callback for them). If that is
+ *         not possible either, the io_uring instance is closed (cancelling the requests) and the thread pool is used from then on.
+ */
+void AsyncFileReader::read(const Request *requests, std::size_t count, const Callback &callback)
+{
+    if (!count) {
+        return;
+    }
+    if (m_ioUring) {
+        readViaIoUring(requests, count, callback);
+    } else {
+        readViaThreadPool(requests, count, callback);
+    }
+}
+
+/*!
+ * \brief Executes the specified \a requests via io_uring.
+ */
+void AsyncFileReader::readViaIoUring(const Request *requests, std::size_t count, const Callback &callback)
+{
+#ifdef CPP_UTILITIES_USE_IO_URING
+    auto &ring = *m_ioUring;
+    auto vectors = std::vector<iovec>(count);
+    auto bytesRead = std::vector<std::size_t>(count);
+    auto requeued = std::vector<std::size_t>();
+    auto error = std::exception_ptr();
+    auto next = std::size_t(), inFlight = std::size_t(), completed = std::size_t();
+    auto unsubmitted = 0u;
+    while (completed != count) {
+        // fill the submission queue with requeued requests (after short reads) and new requests
+        auto tail = *ring.submissionTail;
+        const auto mask = *ring.submissionMask;
+        while (inFlight < ring.entries && (!requeued.empty() || next != count)) {
+            auto index = std::size_t();
+            if (!requeued.empty()) {
+                index = requeued.back();
+                requeued.pop_back();
+            } else {
+                index = next++;
+            }
+            const auto &request = requests[index];
+            auto &vector = vectors[index];
+            vector.iov_base = request.buffer + bytesRead[index];
+            vector.iov_len = std::min<std::size_t>(request.length - bytesRead[index], 0x7ffff000);
+            const auto slot = tail & mask;
+            auto &entry = ring.submissionEntries[slot];
+            std::memset(&entry, 0, sizeof(entry));
+            entry.opcode = IORING_OP_READV;
+            entry.fd = m_fileDescriptor;
+            entry.addr = reinterpret_cast<std::uint64_t>(&vector);
+            entry.len = 1;
+            entry.off = request.offset + bytesRead[index];
+            entry.user_data = index;
+            ring.submissionArray[slot] = slot;
+            ++tail;
+            ++unsubmitted;
+            ++inFlight;
+        }
+        __atomic_store_n(ring.submissionTail, tail, __ATOMIC_RELEASE);
+
+        // submit entries and wait for at least one completion (entries the kernel could not take yet are submitted in the next iteration)
+        try {
+            unsubmitted -= enterIoUring(unsubmitted, 1);
+        } catch (const std::ios_base::failure &) {
+            abortIoUringRequests(inFlight - unsubmitted);
+            throw;
+        }
+
+        // process completions
+        auto head = *ring.completionHead;
+        const auto completionTail = __atomic_load_n(ring.completionTail, __ATOMIC_ACQUIRE);
+        for (; head != completionTail; ++head) {
+            const auto &entry = ring.completionEntries[head & *ring.completionMask];
+            const auto index = static_cast<std::size_t>(entry.user_data);
+            const auto &request = requests[index];
+            --inFlight;
+            auto ec = std::error_code();
+            if (entry.res == -EINTR || entry.res == -EAGAIN) {
+                requeued.emplace_back(index);
+                continue;
+            } else if (entry.res < 0) {
+                ec = std::error_code(-entry.res, std::system_category());
+            } else if (entry.res > 0 && (bytesRead[index] += static_cast<std::size_t>(entry.res)) < request.length) {
+                requeued.emplace_back(index);
+                continue;
+            }
+            ++completed;
+            if (!error) {
+                try {
+                    callback(request, bytesRead[index], ec);
+                } catch (...) {
+                    error = std::current_exception();
+                }
+            }
+        }
+        __atomic_store_n(ring.completionHead, head, __ATOMIC_RELEASE);
+    }
+    if (error) {
+        std::rethrow_exception(error);
+    }
+#else
+    CPP_UTILITIES_UNUSED(requests)
+    CPP_UTILITIES_UNUSED(count)
+    CPP_UTILITIES_UNUSED(callback)
+#endif
+}
+
+#ifdef CPP_UTILITIES_USE_IO_URING
+/*!
+ * \brief Submits \a toSubmit entries to the io_uring instance and waits for at least \a minComplete completions.
+ * \sa Detail::IoUring::enter()
+ * \remarks Failures can be simulated via m_simulatedEnterFailures for testing purposes. Each call consumes its lowest bit
+ *          and fails if it is set.
+ */
+unsigned int AsyncFileReader::enterIoUring(unsigned int toSubmit, unsigned int minComplete)
+{
+    const auto simulateFailure = m_simulatedEnterFailures & 1u;
+    m_simulatedEnterFailures >>= 1;
+    if (simulateFailure) {
+        throw std::ios_base::failure("io_uring_enter failed", std::error_code(EIO, std::system_category()));
+    }
+    return m_ioUring->enter(toSubmit, minComplete);
+}
+
+/*!
+ * \brief Discards entries which have not been submitted yet and waits for the \a submitted entries to complete.
+ * \remarks If waiting fails, the io_uring instance is closed (which cancels the requests still in flight) so the
+ *          thread pool is used for further reads.
+ */
+void AsyncFileReader::abortIoUringRequests(std::size_t submitted)
+{
+    auto &ring = *m_ioUring;
+    __atomic_store_n(ring.submissionTail, __atomic_load_n(ring.submissionHead, __ATOMIC_ACQUIRE), __ATOMIC_RELEASE);
+    try {
+        while (submitted) {
+            enterIoUring(0, 1);
+            const auto completionTail = __atomic_load_n(ring.completionTail, __ATOMIC_ACQUIRE);
+            submitted -= completionTail - *ring.completionHead;
+            __atomic_store_n(ring.completionHead, completionTail, __ATOMIC_RELEASE);
+        }
+    } catch (const std::ios_base::failure &) {
+        m_ioUring.reset();
+    }
+}
+#endif
+
+/*!
+ * \brief Executes the specified \a requests via the thread pool starting it if not done yet.
+ */
+void AsyncFileReader::readViaThreadPool(const Request *requests, std::size_t count, const Callback &callback)
+{
+    auto lock = std::unique_lock(m_mutex);
+    if (m_threads.empty()) {
+        const auto threadCount = std::min<std::size_t>(m_queueDepth, 32);
+        m_threads.reserve(threadCount);
+        for (auto i = std::size_t(); i != threadCount; ++i) {
+            m_threads.emplace_back(&AsyncFileReader::processRequests, this);
+        }
+    }
+    for (const auto *request = requests, *end = requests + count; request != end; ++request) {
+        m_pendingRequests.emplace_back(request);
+    }
+    m_requestsAvailable.notify_all();
+
+    auto completions = std::vector<Completion>();
+    auto error = std::exception_ptr();
+    for (auto remaining = count; remaining; remaining -= completions.size()) {
+        m_completionsAvailable.wait(lock, [this] { return !m_completions.empty(); });
+        completions.swap(m_completions);
+        m_completions.clear();
+        lock.unlock();
+        for (const auto &completion : completions) {
+            if (!error) {
+                try {
+                    callback(*completion.request, completion.bytesRead, completion.error);
+                } catch (...) {
+                    error = std::current_exception();
+                }
+            }
+        }
+        lock.lock();
+    }
+    lock.unlock();
+    if (error) {
+        std::rethrow_exception(error);
+    }
+}
+
+/*!
+ * \brief Executes pending requests; runs within the threads of the thread pool.
+ */
+void AsyncFileReader::processRequests()
+{
+    auto lock = std::unique_lock(m_mutex);
+    for (;;) {
+        m_requestsAvailable.wait(lock, [this] { return m_stopping || !m_pendingRequests.empty(); });
+        if (m_stopping) {
+            return;
+        }
+        const auto *const request = m_pendingRequests.front();
+        m_pendingRequests.pop_front();
+        lock.unlock();
+        auto ec = std::error_code();
+        const auto bytesRead = Detail::readAt(m_fileDescriptor, request->buffer, request->length, request->offset, ec);
+        lock.lock();
+        m_completions.emplace_back(Completion{ request, bytesRead, ec });
+        m_completionsAvailable.notify_one();
+    }
+}
+
+} // namespace CppUtilities
@@ -0,0 +1,133 @@
+#ifndef IOUTILITIES_ASYNCFILEREADER_H
+#define IOUTILITIES_ASYNCFILEREADER_H
+
+#include "./nativefilestream.h"
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+class IoTests; // not a public class (only used for internal tests)
+
+namespace CppUtilities {
+
+/// \cond
+namespace Detail {
+struct IoUring;
+}
+/// \endcond
+
+class CPP_UTILITIES_EXPORT AsyncFileReader {
+    friend IoTests;
+
+public:
+    /*!
+     * \brief The Request struct specifies a read of \a length bytes at \a offset into \a buffer.
+     */
+    struct Request {
+        std::uint64_t offset = 0;
+        std::size_t length = 0;
+        char *buffer = nullptr;
+    };
+    using Callback = std::function<void(const Request &request, std::size_t bytesRead, const std::error_code &error)>;
+    enum class Backend {
+        IoUring, /**< requests are submitted via io_uring (Linux only) */
+        ThreadPool, /**< requests are executed via pread() (or ReadFile() under Windows) within a pool of threads */
+    };
+
+    explicit AsyncFileReader(int fileDescriptor, std::size_t queueDepth = defaultQueueDepth, Backend preferredBackend = Backend::IoUring);
+#ifdef CPP_UTILITIES_USE_NATIVE_FILE_BUFFER
+    explicit AsyncFileReader(NativeFileStream &stream, std::size_t queueDepth = defaultQueueDepth, Backend preferredBackend = Backend::IoUring);
+#endif
+    AsyncFileReader(const AsyncFileReader &) = delete;
+    AsyncFileReader &operator=(const AsyncFileReader &) = delete;
+    ~AsyncFileReader();
+
+    int fileDescriptor() const;
+    Backend backend() const;
+    std::size_t queueDepth() const;
+    void read(const Request *requests, std::size_t count, const Callback &callback);
+    void read(const std::vector<Request> &requests, const Callback &callback);
+
+    static constexpr std::size_t defaultQueueDepth = 64;
+
+private:
+    struct Completion {
+        const Request *request;
+        std::size_t bytesRead;
+        std::error_code error;
+    };
+
+    void readViaIoUring(const Request *requests, std::size_t count, const Callback &callback);
+    unsigned int enterIoUring(unsigned int toSubmit, unsigned int minComplete);
+    void abortIoUringRequests(std::size_t submitted);
+    void readViaThreadPool(const Request *requests, std::size_t count, const Callback &callback);
+    void processRequests();
+
+    int m_fileDescriptor;
+    std::size_t m_queueDepth;
+    std::unique_ptr<Detail::IoUring> m_ioUring;
+    std::vector<std::thread> m_threads;
+    std::mutex m_mutex;
+    std::condition_variable m_requestsAvailable;
+    std::condition_variable m_completionsAvailable;
+    std::deque<const Request *> m_pendingRequests;
+    std::vector<Completion> m_completions;
+    bool m_stopping;
+    std::uint32_t m_simulatedEnterFailures;
+};
+
+#ifdef CPP_UTILITIES_USE_NATIVE_FILE_BUFFER
+/*!
+ * \brief Constructs an AsyncFileReader for the file the specified \a stream has opened.
+ * \remarks The \a stream must stay open as long as the AsyncFileReader is used. Its position is not used or altered.
+ * \sa See the other constructor for the meaning of \a queueDepth and \a preferredBackend.
+ */
+inline AsyncFileReader::AsyncFileReader(NativeFileStream &stream, std::size_t queueDepth, Backend preferredBackend)
+    : AsyncFileReader(stream.fileDescriptor(), queueDepth, preferredBackend)
+{
+}
+#endif
+
+/*!
+ * \brief Returns the file descriptor of the file to read from.
+ */
+inline int AsyncFileReader::fileDescriptor() const
+{
+    return m_fileDescriptor;
+}
+
+/*!
+ * \brief Returns the backend which is used to execute requests.
+ */
+inline AsyncFileReader::Backend AsyncFileReader::backend() const
+{
+    return m_ioUring ? Backend::IoUring : Backend::ThreadPool;
+}
+
+/*!
+ * \brief Returns the maximum number of requests which are executed at the same time.
+ */
+inline std::size_t AsyncFileReader::queueDepth() const
+{
+    return m_queueDepth;
+}
+
+/*!
+ * \brief Executes the specified \a requests invoking \a callback for each of them once completed.
+ * \sa See the other overload for details.
+ */
+inline void AsyncFileReader::read(const std::vector<Request> &requests, const Callback &callback)
+{
+    read(requests.data(), requests.size(), callback);
+}
+
+} // namespace CppUtilities
+
+#endif // IOUTILITIES_ASYNCFILEREADER_H
@@ -0,0 +1,314 @@
+#ifndef IOUTILITIES_BASICBITREADER_H
+#define IOUTILITIES_BASICBITREADER_H
+
+#include "../conversion/binaryconversion.h"
+#include "../global.h"
+
+#include <cstdint>
+#include <ios>
+
+namespace CppUtilities {
+
+namespace Detail {
+
+/*!
+ * \brief Specifies the order in which bits are taken from each byte.
+ */
+enum class BitOrder {
+    MsbFirst, /**< most significant bit first; the cache holds the next bits left-aligned (BitReader) */
+    LsbFirst, /**< least significant bit first; the cache holds the next bits right-aligned (LsbBitReader) */
+};
+
+/*!
+ * \brief The BasicBitReader class implements the 64-bit cache and the bounds checking shared by BitReader and LsbBitReader.
+ *
+ * The cache is refilled via a single unaligned load (big endian for BitOrder::MsbFirst and little endian for
+ * BitOrder::LsbFirst) as long as at least 8 bytes are left so reading, showing and skipping a number of bits usually only
+ * boils down to a few shifts. Only the direction of the shifts depends on \a order.
+ *
+ * The \a Derived class may leave out bytes of the buffer (like BitReader does with emulation prevention bytes) by hiding
+ * nextEscape(), remainingEscapes() and skipEmulationPreventionByte().
+ */
+template <typename Derived, BitOrder order> class BasicBitReader {
+public:
+    template <typename intType> intType readBits(std::uint8_t bitCount);
+    std::uint8_t readBit();
+    template <typename intType> intType showBits(std::uint8_t bitCount);
+    void skipBits(std::size_t bitCount);
+    void align();
+    std::size_t bitsAvailable();
+    void reset(const char *buffer, std::size_t bufferSize);
+    void reset(const char *buffer, const char *end);
+
+protected:
+    BasicBitReader(const char *buffer, const char *end);
+
+    void refill();
+    void consume(std::uint8_t bitCount);
+    std::uint64_t peek(std::uint8_t bitCount) const;
+    const std::uint8_t *nextEscape() const;
+    std::size_t remainingEscapes() const;
+    void skipEmulationPreventionByte();
+
+    const std::uint8_t *m_buffer;
+    const std::uint8_t *m_end;
+    std::uint64_t m_cache;
+    std::uint8_t m_cacheBits;
+
+private:
+    Derived &derived();
+};
+
+/*!
+ * \brief Constructs a new BasicBitReader.
+ * \remarks
+ *  - Does not take ownership over the specified \a buffer.
+ *  - \a end must not be less than \a buffer.
+ */
+template <typename Derived, BitOrder order>
+inline BasicBitReader<Derived, order>::BasicBitReader(const char *buffer, const char *end)
+    : m_buffer(reinterpret_cast<const std::uint8_t *>(buffer))
+    , m_end(reinterpret_cast<const std::uint8_t *>(end))
+    , m_cache(0)
+    , m_cacheBits(0)
+{
+}
+
+/*!
+ * \brief Returns the derived reader.
+ */
+template <typename Derived, BitOrder order> inline Derived &BasicBitReader<Derived, order>::derived()
+{
+    return static_cast<Derived &>(*this);
+}
+
+/*!
+ * \brief Returns the position of the next byte to be left out or m_end if there is none.
+ * \remarks The cache is refilled via the single load only if this is at least 8 bytes away.
+ */
+template <typename Derived, BitOrder order> inline const std::uint8_t *BasicBitReader<Derived, order>::nextEscape() const
+{
+    return m_end;
+}
+
+/*!
+ * \brief Returns the number of bytes to be left out within the remaining buffer.
+ */
+template <typename Derived, BitOrder order> inline std::size_t BasicBitReader<Derived, order>::remainingEscapes() const
+{
+    return 0;
+}
+
+/*!
+ * \brief Leaves out the byte the buffer is currently at; only called if m_buffer is at nextEscape().
+ */
+template <typename Derived, BitOrder order> inline void BasicBitReader<Derived, order>::skipEmulationPreventionByte()
+{
+}
+
+/*!
+ * \brief Loads as many bytes from the buffer into the cache as fit.
+ *
+ * If at least 8 bytes are left in front of nextEscape(), they are loaded via a single unaligned load and the cache is
+ * afterwards filled with at least 56 bits. Only whole bytes are accounted for in m_cacheBits; the bits of a partially
+ * loaded byte beyond them are loaded again (yielding the same bits) on the next refill. Otherwise bytes are loaded one
+ * by one and the byte at nextEscape() is left out.
+ */
+template <typename Derived, BitOrder order> inline void BasicBitReader<Derived, order>::refill()
+{
+    auto &reader = derived();
+    if (reader.nextEscape() - m_buffer >= 8) {
+        if constexpr (order == BitOrder::MsbFirst) {
+            m_cache |= BE::toInt<std::uint64_t>(reinterpret_cast<const char *>(m_buffer)) >> m_cacheBits;
+        } else {
+            m_cache |= LE::toInt<std::uint64_t>(reinterpret_cast<const char *>(m_buffer)) << m_cacheBits;
+        }
+        m_buffer += (63 - m_cacheBits) >> 3;
+        m_cacheBits |= 56;
+        return;
+    }
+    while (m_cacheBits < 56 && m_buffer != m_end) {
+        if (m_buffer == reader.nextEscape()) {
+            reader.skipEmulationPreventionByte();
+            continue;
+        }
+        if constexpr (order == BitOrder::MsbFirst) {
+            m_cache |= static_cast<std::uint64_t>(*m_buffer++) << (56 - m_cacheBits);
+        } else {
+            m_cache |= static_cast<std::uint64_t>(*m_buffer++) << m_cacheBits;
+        }
+        m_cacheBits = static_cast<std::uint8_t>(m_cacheBits + 8);
+    }
+}
+
+/*!
+ * \brief Removes the specified number of bits (which must be present and less than 64) from the cache.
+ */
+template <typename Derived, BitOrder order> inline void BasicBitReader<Derived, order>::consume(std::uint8_t bitCount)
+{
+    if constexpr (order == BitOrder::MsbFirst) {
+        m_cache <<= bitCount;
+    } else {
+        m_cache >>= bitCount;
+    }
+    m_cacheBits = static_cast<std::uint8_t>(m_cacheBits - bitCount);
+}
+
+/*!
+ * \brief Returns the next \a bitCount bits (which must be present and less than 64) of the cache without consuming them.
+ */
+template <typename Derived, BitOrder order> inline std::uint64_t BasicBitReader<Derived, order>::peek(std::uint8_t bitCount) const
+{
+    if constexpr (order == BitOrder::MsbFirst) {
+        return m_cache >> 1 >> (63 - bitCount);
+    } else {
+        return m_cache & ~(~std::uint64_t(0) << bitCount);
+    }
+}
+
+/*!
+ * \brief Reads the specified number of bits from the buffer advancing the current position by \a bitCount bits.
+ * \param bitCount Specifies the number of bits read (at most 64).
+ * \tparam intType Specifies the type of the returned value.
+ * \remarks
+ * - With BitOrder::MsbFirst the first bit read becomes the most significant bit of the returned value and with
+ *   BitOrder::LsbFirst it becomes the least significant bit (as within DEFLATE or FLAC residuals).
+ * - Does not check whether intType is big enough to hold result.
+ * \throws Throws ios_base::failure if the end of the buffer is exceeded.
+ *         The reader becomes invalid in that case.
+ */
+template <typename Derived, BitOrder order> template <typename intType> intType BasicBitReader<Derived, order>::readBits(std::uint8_t bitCount)
+{
+    if (bitCount > m_cacheBits || bitCount > 56) {
+        if (bitCount > 56) {
+            // the cache is not guaranteed to hold more than 56 bits after a refill so read in two steps
+            if constexpr (order == BitOrder::MsbFirst) {
+                const auto high = readBits<std::uint64_t>(static_cast<std::uint8_t>(bitCount - 32));
+                return static_cast<intType>((high << 32) | readBits<std::uint64_t>(32));
+            } else {
+                const auto low = readBits<std::uint64_t>(32);
+                return static_cast<intType>(low | (readBits<std::uint64_t>(static_cast<std::uint8_t>(bitCount - 32)) << 32));
+            }
+        }
+        refill();
+        if (bitCount > m_cacheBits) {
+            throw std::ios_base::failure("end of buffer exceeded");
+        }
+    }
+    const auto value = peek(bitCount);
+    consume(bitCount);
+    return static_cast<intType>(value);
+}
+
+/*!
+ * \brief Reads the one bit from the buffer advancing the current position by one bit.
+ * \throws Throws ios_base::failure if the end of the buffer is exceeded.
+ *         The reader becomes invalid in that case.
+ */
+template <typename Derived, BitOrder order> inline std::uint8_t BasicBitReader<Derived, order>::readBit()
+{
+    return readBits<std::uint8_t>(1) == 1;
+}
+
+/*!
+ * \brief Reads the specified number of bits from the buffer without advancing the current position.
+ * \param bitCount Specifies the number of bits read (at most 64).
+ * \throws Throws ios_base::failure if the end of the buffer is exceeded.
+ */
+template <typename Derived, BitOrder order> template <typename intType> intType BasicBitReader<Derived, order>::showBits(std::uint8_t bitCount)
+{
+    if (bitCount > m_cacheBits || bitCount > 56) {
+        if (bitCount > 56) {
+            auto tmp = derived();
+            return tmp.template readBits<intType>(bitCount);
+        }
+        refill();
+        if (bitCount > m_cacheBits) {
+            throw std::ios_base::failure("end of buffer exceeded");
+        }
+    }
+    return static_cast<intType>(peek(bitCount));
+}
+
+/*!
+ * \brief Skips the specified number of bits without reading it.
+ * \param bitCount Specifies the number of bits to skip.
+ * \throws Throws std::ios_base::failure if the end of the buffer is exceeded.
+ *         The reader becomes invalid in that case.
+ */
+template <typename Derived, BitOrder order> void BasicBitReader<Derived, order>::skipBits(std::size_t bitCount)
+{
+    if (bitCount < m_cacheBits) {
+        consume(static_cast<std::uint8_t>(bitCount));
+        return;
+    }
+    // drop the cache and skip whole bytes within the buffer (leaving out bytes at nextEscape())
+    auto &reader = derived();
+    bitCount -= m_cacheBits;
+    m_cache = 0;
+    m_cacheBits = 0;
+    auto bytes = bitCount / 8;
+    for (auto *escape = reader.nextEscape(); escape != m_end && static_cast<std::size_t>(escape - m_buffer) <= bytes; escape = reader.nextEscape()) {
+        bytes -= static_cast<std::size_t>(escape - m_buffer);
+        m_buffer = escape;
+        reader.skipEmulationPreventionByte();
+    }
+    if (bytes > static_cast<std::size_t>(m_end - m_buffer)) {
+        m_buffer = m_end;
+        throw std::ios_base::failure("end of buffer exceeded");
+    }
+    m_buffer += bytes;
+    if ((bitCount %= 8)) {
+        refill();
+        if (!m_cacheBits) {
+            throw std::ios_base::failure("end of buffer exceeded");
+        }
+        consume(static_cast<std::uint8_t>(bitCount));
+    }
+}
+
+/*!
+ * \brief Returns the number of bits which are still available to read.
+ */
+template <typename Derived, BitOrder order> inline std::size_t BasicBitReader<Derived, order>::bitsAvailable()
+{
+    return (static_cast<std::size_t>(m_end - m_buffer) - derived().remainingEscapes()) * 8 + m_cacheBits;
+}
+
+/*!
+ * \brief Resets the reader.
+ * \remarks Does not take ownership over the specified \a buffer.
+ */
+template <typename Derived, BitOrder order> inline void BasicBitReader<Derived, order>::reset(const char *buffer, std::size_t bufferSize)
+{
+    derived().reset(buffer, buffer + bufferSize);
+}
+
+/*!
+ * \brief Resets the reader.
+ * \remarks
+ *  - Does not take ownership over the specified \a buffer.
+ *  - \a end must not be less than \a buffer.
+ */
+template <typename Derived, BitOrder order> inline void BasicBitReader<Derived, order>::reset(const char *buffer, const char *end)
+{
+    m_buffer = reinterpret_cast<const std::uint8_t *>(buffer);
+    m_end = reinterpret_cast<const std::uint8_t *>(end);
+    m_cache = 0;
+    m_cacheBits = 0;
+}
+
+/*!
+ * \brief Re-establishes alignment skipping the remaining bits of the current byte.
+ * \remarks Does nothing if the current position is already at a byte boundary.
+ */
+template <typename Derived, BitOrder order> inline void BasicBitReader<Derived, order>::align()
+{
+    consume(m_cacheBits % 8);
+}
+
+} // namespace Detail
+
+} // namespace CppUtilities
+
+#endif // IOUTILITIES_BASICBITREADER_H
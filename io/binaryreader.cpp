@@ -1,19 +1,64 @@
 #include "./binaryreader.h"
 
+#include "./crc32.h"
+#include "./nativefilestream.h"
+
 #include "../conversion/conversionexception.h"
+#include "../misc/math.h"
 
+#include <algorithm>
 #include <cstring>
+#include <exception>
+#include <limits>
 #include <memory>
-#include <sstream>
+#include <streambuf>
+
+#if defined(CPP_UTILITIES_USE_NATIVE_FILE_BUFFER) && (defined(PLATFORM_WINDOWS) || defined(PLATFORM_UNIX))
+#define CPP_UTILITIES_BINARY_READER_USE_FSTAT
+#include <sys/stat.h>
+#endif
 
 using namespace std;
 
 namespace CppUtilities {
 
+/// \cond
+namespace Detail {
+/*!
+ * \brief Provides access to the get area of a std::streambuf.
+ * \remarks Pointers to the protected members can be formed within a derived class and then be applied to any std::streambuf.
+ */
+struct GetAreaAccess : public std::streambuf {
+    static const char *current(std::streambuf *buffer)
+    {
+        return (buffer->*(&GetAreaAccess::gptr))();
+    }
+    static const char *end(std::streambuf *buffer)
+    {
+        return (buffer->*(&GetAreaAccess::egptr))();
+    }
+    static void advance(std::streambuf *buffer, std::size_t count)
+    {
+        (buffer->*(&GetAreaAccess::gbump))(static_cast<int>(count));
+    }
+};
+
+/*!
+ * \brief Throws the exception used to indicate an invalid length denotation of a variable length unsigned integer.
+ */
+[[noreturn]] void throwVariableLengthIntegerExceedsMaximum()
+{
+    throw ConversionException("Length denotation of variable length unsigned integer exceeds maximum.");
+}
+
+} // namespace Detail
+/// \endcond
+
 /*!
  * \class BinaryReader
  * \brief Reads primitive data types from a std::istream.
  * \remarks Supports both, little endian and big endian.
+ * \sa For reading from a buffer which is already in memory, see BufferReader.
  * \sa For automatic serialization of structs, see https://github.com/Martchus/reflective-rapidjson.
  */
 
@@ -40,6 +85,7 @@ void BinaryReader::setStream(istream *stream, bool giveOwnership)
         m_stream = nullptr;
         m_ownership = false;
     }
+    invalidateCache();
 }
 
 /*!
@@ -54,6 +100,11 @@ istream::pos_type BinaryReader::readStreamsize()
     m_stream->seekg(0, ios_base::end);
     const auto streamsize = m_stream->tellg();
     m_stream->seekg(cp);
+    if (cp != istream::pos_type(-1) && streamsize != istream::pos_type(-1)) {
+        m_position = static_cast<std::uint64_t>(cp);
+        m_size = static_cast<std::uint64_t>(streamsize);
+        m_positionCached = m_sizeCached = true;
+    }
     return streamsize;
 }
 
@@ -69,25 +120,146 @@ istream::pos_type BinaryReader::readRemainingBytes()
     m_stream->seekg(0, ios_base::end);
     const auto streamsize = m_stream->tellg();
     m_stream->seekg(cp);
+    if (cp != istream::pos_type(-1) && streamsize != istream::pos_type(-1)) {
+        m_position = static_cast<std::uint64_t>(cp);
+        m_size = static_cast<std::uint64_t>(streamsize);
+        m_positionCached = m_sizeCached = true;
+    }
     return streamsize - cp;
 }
 
+/*!
+ * \brief Determines the current position of the stream via std::istream::tellg() to initialize the tracked position.
+ * \remarks If the position can not be determined (e.g. because the stream is in a failed state) it is assumed to be zero
+ *          and not cached.
+ */
+void BinaryReader::cachePosition()
+{
+    const auto cp = m_stream->tellg();
+    m_positionCached = cp != istream::pos_type(-1);
+    m_position = m_positionCached ? static_cast<std::uint64_t>(cp) : 0;
+}
+
+/*!
+ * \brief Determines the size of the stream via fstat() if possible and by seeking otherwise.
+ */
+void BinaryReader::cacheSize()
+{
+#ifdef CPP_UTILITIES_BINARY_READER_USE_FSTAT
+    if (auto *const nativeFileStream = dynamic_cast<NativeFileStream *>(m_stream); nativeFileStream && nativeFileStream->fileDescriptor() != -1) {
+        // ensure pending writes are taken into account
+        m_stream->rdbuf()->pubsync();
+#ifdef PLATFORM_WINDOWS
+        struct _stat64 fileInfo;
+        if (!_fstat64(nativeFileStream->fileDescriptor(), &fileInfo) && (fileInfo.st_mode & _S_IFREG)) {
+#else
+        struct stat fileInfo;
+        if (!fstat(nativeFileStream->fileDescriptor(), &fileInfo) && S_ISREG(fileInfo.st_mode)) {
+#endif
+            m_size = static_cast<std::uint64_t>(fileInfo.st_size);
+            m_sizeCached = true;
+            return;
+        }
+    }
+#endif
+    readStreamsize();
+}
+
+/*!
+ * \brief Reads an up to 8 byte long big endian unsigned integer from the current stream and advances the current position of the stream by one to eight byte.
+ * \throws Throws ConversionException if the size of the integer exceeds the maximum.
+ * \remarks If at least 8 bytes are available in the get area of the stream buffer, the integer is decoded via a single
+ *          unaligned load without further interaction with the stream.
+ */
+std::uint64_t BinaryReader::readVariableLengthUIntBE()
+{
+    auto *const buffer = m_stream->rdbuf();
+    if (buffer && m_stream->good()) {
+        const auto *const current = Detail::GetAreaAccess::current(buffer);
+        if (Detail::GetAreaAccess::end(buffer) - current >= 8) {
+            const auto firstByte = static_cast<std::uint8_t>(*current);
+            if (!firstByte) {
+                Detail::throwVariableLengthIntegerExceedsMaximum();
+            }
+            const auto prefixLength = static_cast<unsigned int>(countLeadingZeros(firstByte)) + 1;
+            Detail::GetAreaAccess::advance(buffer, prefixLength);
+            m_position += prefixLength;
+            // shift out the bytes following the integer and mask out the length denotation
+            return (BE::toInt<std::uint64_t>(current) >> (64 - 8 * prefixLength)) & ((static_cast<std::uint64_t>(1) << (7 * prefixLength)) - 1);
+        }
+    }
+    bufferVariableLengthInteger();
+    return BE::toInt<std::uint64_t>(m_buffer);
+}
+
+/*!
+ * \brief Reads a LEB128 encoded unsigned integer from the current stream and advances the current position of the stream by one to ten bytes.
+ *
+ * This encoding is used by e.g. Protocol Buffers, DWARF and WebAssembly.
+ *
+ * \throws Throws ConversionException if the integer exceeds 64 bit and std::ios_base::failure if the stream ends within
+ *         the integer (like BufferReader::readVarUInt64()). The bytes read so far are consumed in the latter case.
+ * \remarks If the integer is available within the get area of the stream buffer, it is decoded from there without further
+ *          interaction with the stream.
+ * \sa <a href="https://en.wikipedia.org/wiki/LEB128">LEB128 - Wikipedia</a>
+ */
+std::uint64_t BinaryReader::readVarUInt64()
+{
+    auto value = std::uint64_t();
+    auto *const buffer = m_stream->rdbuf();
+    if (buffer && m_stream->good()) {
+        const auto *const begin = Detail::GetAreaAccess::current(buffer);
+        const auto *current = begin;
+        if (fromVarUInt64s(current, Detail::GetAreaAccess::end(buffer), &value, 1)) {
+            Detail::GetAreaAccess::advance(buffer, static_cast<std::size_t>(current - begin));
+            m_position += static_cast<std::uint64_t>(current - begin);
+            return value;
+        }
+    }
+    char bytes[10];
+    auto size = std::size_t();
+    while (size != sizeof(bytes)) {
+        const auto byte = m_stream->get();
+        if (istream::traits_type::eq_int_type(byte, istream::traits_type::eof())) {
+            break;
+        }
+        bytes[size++] = istream::traits_type::to_char_type(byte);
+        ++m_position;
+        if (!(byte & 0x80)) {
+            break;
+        }
+    }
+    const auto *current = static_cast<const char *>(bytes);
+    if (!fromVarUInt64s(current, bytes + size, &value, 1)) {
+        throw std::ios_base::failure("end of stream exceeded");
+    }
+    return value;
+}
+
+/*!
+ * \brief Reads a variable length integer into m_buffer (right-aligned, without length denotation).
+ * \remarks The bytes are taken from the get area of the stream buffer if available and only read via the stream otherwise.
+ */
 void BinaryReader::bufferVariableLengthInteger()
 {
-    static constexpr int maxPrefixLength = 8;
-    int prefixLength = 1;
-    const auto beg = static_cast<std::uint8_t>(m_stream->peek());
-    std::uint8_t mask = 0x80;
-    while (prefixLength <= maxPrefixLength && (beg & mask) == 0) {
-        ++prefixLength;
-        mask >>= 1;
+    static constexpr auto maxPrefixLength = 8;
+    auto *const buffer = m_stream->good() ? m_stream->rdbuf() : nullptr;
+    const auto *const current = buffer ? Detail::GetAreaAccess::current(buffer) : nullptr;
+    const auto available = buffer ? Detail::GetAreaAccess::end(buffer) - current : 0;
+    const auto firstByte = static_cast<std::uint8_t>(available ? *current : m_stream->peek());
+    if (!firstByte) {
+        Detail::throwVariableLengthIntegerExceedsMaximum();
     }
-    if (prefixLength > maxPrefixLength) {
-        throw ConversionException("Length denotation of variable length unsigned integer exceeds maximum.");
+    const auto prefixLength = countLeadingZeros(firstByte) + 1;
+    memset(m_buffer, 0, maxPrefixLength - prefixLength);
+    if (available >= prefixLength) {
+        memcpy(m_buffer + (maxPrefixLength - prefixLength), current, static_cast<std::size_t>(prefixLength));
+        Detail::GetAreaAccess::advance(buffer, static_cast<std::size_t>(prefixLength));
+        m_position += static_cast<std::uint64_t>(prefixLength);
+    } else {
+        readData(m_buffer + (maxPrefixLength - prefixLength), prefixLength);
     }
-    memset(m_buffer, 0, maxPrefixLength);
-    m_stream->read(m_buffer + (maxPrefixLength - prefixLength), prefixLength);
-    *(m_buffer + (maxPrefixLength - prefixLength)) ^= static_cast<char>(mask);
+    *(m_buffer + (maxPrefixLength - prefixLength)) ^= static_cast<char>(0x80 >> (prefixLength - 1));
 }
 
 /*!
@@ -96,11 +268,40 @@ void BinaryReader::bufferVariableLengthInteger()
 string BinaryReader::readString(size_t length)
 {
     string res;
-    res.resize(length);
-    m_stream->read(&res[0], static_cast<streamsize>(length));
+    readString(res, length);
     return res;
 }
 
+/*!
+ * \brief Reads a string of the given \a length from the current stream into \a result and advances the current position of the
+ *        stream by \a length byte.
+ * \remarks
+ * - The capacity of \a result is reused so no allocation happens if it is already big enough.
+ * - When compiled with a standard library providing std::string::resize_and_overwrite() the string is not zero-filled before
+ *   reading into it and only contains the bytes actually read if the end of the stream is reached prematurely.
+ */
+void BinaryReader::readString(std::string &result, std::size_t length)
+{
+#ifdef __cpp_lib_string_resize_and_overwrite
+    // catch exceptions within the operation as it must not throw
+    auto error = std::exception_ptr();
+    result.resize_and_overwrite(length, [this, &error](char *data, std::size_t size) {
+        try {
+            readData(data, static_cast<streamsize>(size));
+        } catch (...) {
+            error = std::current_exception();
+        }
+        return static_cast<std::size_t>(m_stream->gcount());
+    });
+    if (error) {
+        std::rethrow_exception(error);
+    }
+#else
+    result.resize(length);
+    readData(result.data(), static_cast<streamsize>(length));
+#endif
+}
+
 /*!
  * \brief Reads a terminated string from the current stream.
  *
@@ -110,11 +311,9 @@ string BinaryReader::readString(size_t length)
  */
 std::string BinaryReader::readTerminatedString(std::uint8_t termination)
 {
-    stringstream ss(ios_base::in | ios_base::out | ios_base::binary);
-    ss.exceptions(ios_base::badbit | ios_base::failbit);
-    m_stream->get(*ss.rdbuf(), static_cast<char>(termination)); // delim byte is not extracted from the stream
-    m_stream->seekg(1, ios_base::cur); // "extract" delim byte manually
-    return ss.str();
+    auto res = std::string();
+    readTerminatedString(res, std::numeric_limits<std::size_t>::max(), termination);
+    return res;
 }
 
 /*!
@@ -128,16 +327,79 @@ std::string BinaryReader::readTerminatedString(std::uint8_t termination)
  */
 string BinaryReader::readTerminatedString(std::size_t maxBytesToRead, std::uint8_t termination)
 {
-    string res;
+    auto res = std::string();
     res.reserve(maxBytesToRead);
-    while (res.size() < maxBytesToRead) {
-        const auto c = static_cast<char>(m_stream->get());
-        if (static_cast<std::uint8_t>(c) == termination) {
-            return res;
+    readTerminatedString(res, maxBytesToRead, termination);
+    return res;
+}
+
+/*!
+ * \brief Reads a terminated string from the current stream into \a result.
+ *
+ * Advances the current position of the stream by the string length plus one byte.
+ *
+ * \param result The string to store the result in. Its capacity is reused so no allocation happens if it is already big enough.
+ * \param termination The byte to be recognized as termination value.
+ */
+void BinaryReader::readTerminatedString(std::string &result, std::uint8_t termination)
+{
+    readTerminatedString(result, std::numeric_limits<std::size_t>::max(), termination);
+}
+
+/*!
+ * \brief Reads a terminated string from the current stream into \a result.
+ *
+ * Advances the current position of the stream by the string length plus one byte but maximal by \a maxBytesToRead.
+ * If the end of the stream is reached before, the eof bit of the stream is set.
+ *
+ * \param result The string to store the result in. Its capacity is reused so no allocation happens if it is already big enough.
+ * \param maxBytesToRead The maximal number of bytes to read.
+ * \param termination The value to be recognized as termination.
+ * \remarks The termination is searched within the get area of the stream buffer via memchr() so bytes are not processed
+ *          one-by-one unless the stream buffer is unbuffered.
+ */
+void BinaryReader::readTerminatedString(std::string &result, std::size_t maxBytesToRead, std::uint8_t termination)
+{
+    result.clear();
+    const auto sentry = istream::sentry(*m_stream, true);
+    if (!sentry) {
+        return;
+    }
+    auto *const buffer = m_stream->rdbuf();
+    while (maxBytesToRead) {
+        const auto *begin = Detail::GetAreaAccess::current(buffer), *end = Detail::GetAreaAccess::end(buffer);
+        if (begin == end) {
+            // fill the get area (or read the next character if the buffer is unbuffered)
+            const auto c = buffer->sgetc();
+            if (istream::traits_type::eq_int_type(c, istream::traits_type::eof())) {
+                m_stream->setstate(ios_base::eofbit);
+                return;
+            }
+            begin = Detail::GetAreaAccess::current(buffer);
+            end = Detail::GetAreaAccess::end(buffer);
+            if (begin == end) {
+                buffer->sbumpc();
+                ++m_position;
+                --maxBytesToRead;
+                if (static_cast<std::uint8_t>(c) == termination) {
+                    return;
+                }
+                result += istream::traits_type::to_char_type(c);
+                continue;
+            }
+        }
+        const auto bytesToSearch = std::min(static_cast<std::size_t>(end - begin), maxBytesToRead);
+        const auto *const terminationPos = static_cast<const char *>(std::memchr(begin, termination, bytesToSearch));
+        const auto bytesToAppend = terminationPos ? static_cast<std::size_t>(terminationPos - begin) : bytesToSearch;
+        const auto bytesToExtract = terminationPos ? bytesToAppend + 1 : bytesToAppend;
+        result.append(begin, bytesToAppend);
+        Detail::GetAreaAccess::advance(buffer, bytesToExtract);
+        m_position += bytesToExtract;
+        if (terminationPos) {
+            return;
         }
-        res += c;
+        maxBytesToRead -= bytesToExtract;
     }
-    return res;
 }
 
 /*!
@@ -146,15 +408,24 @@ string BinaryReader::readTerminatedString(std::size_t maxBytesToRead, std::uint8
  * \remarks Cyclic redundancy check (CRC) is an error-detecting code commonly used in
  *          digital networks and storage devices to detect accidental changes to raw data.
  * \remarks Ogg compatible version
+ * \remarks The data is read in blocks and passed to Crc32. Stops early if the end of the stream is reached.
  * \sa <a href="http://en.wikipedia.org/wiki/Cyclic_redundancy_check">Cyclic redundancy check - Wikipedia</a>
+ * \sa Crc32
  */
 std::uint32_t BinaryReader::readCrc32(size_t length)
 {
-    std::uint32_t crc = 0x00;
-    for (std::uint32_t i = 0; i < length; ++i) {
-        crc = (crc << 8) ^ crc32Table[((crc >> 24) & 0xff) ^ static_cast<std::uint8_t>(m_stream->get())];
+    char block[4096];
+    auto crc = Crc32(Crc32::Variant::Ogg);
+    while (length) {
+        readData(block, static_cast<streamsize>(std::min(length, sizeof(block))));
+        const auto bytesRead = static_cast<std::size_t>(m_stream->gcount());
+        if (!bytesRead) {
+            break;
+        }
+        crc.update(block, bytesRead);
+        length -= bytesRead;
     }
-    return crc;
+    return crc.finalize();
 }
 
 /*!
@@ -164,20 +435,17 @@ std::uint32_t BinaryReader::readCrc32(size_t length)
  *          digital networks and storage devices to detect accidental changes to raw data.
  * \remarks Ogg compatible version
  * \sa <a href="http://en.wikipedia.org/wiki/Cyclic_redundancy_check">Cyclic redundancy check - Wikipedia</a>
+ * \sa Crc32
  */
 std::uint32_t BinaryReader::computeCrc32(const char *buffer, size_t length)
 {
-    std::uint32_t crc = 0x00;
-    for (const char *i = buffer, *end = buffer + length; i != end; ++i) {
-        crc = (crc << 8) ^ crc32Table[((crc >> 24) & 0xff) ^ static_cast<std::uint8_t>(*i)];
-    }
-    return crc;
+    return Crc32::compute(buffer, length, Crc32::Variant::Ogg);
 }
 
 /*!
  * \brief CRC-32 table.
- * \remarks Internally used by readCrc32() method.
- * \sa readCrc32()
+ * \remarks Not used internally anymore because Crc32 uses its own tables for processing multiple bytes at once.
+ *          It is only kept for compatibility.
  */
 const std::uint32_t BinaryReader::crc32Table[] = { 0x00000000, 0x04c11db7, 0x09823b6e, 0x0d4326d9, 0x130476dc, 0x17c56b6b, 0x1a864db2, 0x1e475005,
     0x2608edb8, 0x22c9f00f, 0x2f8ad6d6, 0x2b4bcb61, 0x350c9b64, 0x31cd86d3, 0x3c8ea00a, 0x384fbdbd, 0x4c11db70, 0x48d0c6c7, 0x4593e01e, 0x4152fda9,
@@ -2,7 +2,9 @@
 #define IOUTILITIES_BINERYREADER_H
 
 #include "../conversion/binaryconversion.h"
+#include "./record.h"
 
+#include <algorithm>
 #include <istream>
 #include <string>
 #include <vector>
@@ -27,6 +29,11 @@ public:
     bool canRead() const;
     std::istream::pos_type readStreamsize();
     std::istream::pos_type readRemainingBytes();
+    std::uint64_t position();
+    std::uint64_t size();
+    std::uint64_t remaining();
+    void seek(std::uint64_t position);
+    void invalidateCache();
     void read(char *buffer, std::streamsize length);
     void read(std::uint8_t *buffer, std::streamsize length);
     void read(std::vector<char> &buffer, std::streamsize length);
@@ -43,6 +50,7 @@ public:
     std::int64_t readInt64BE();
     std::uint64_t readUInt64BE();
     std::uint64_t readVariableLengthUIntBE();
+    float readFloat16BE();
     float readFloat32BE();
     double readFloat64BE();
     std::int16_t readInt16LE();
@@ -58,15 +66,47 @@ public:
     std::int64_t readInt64LE();
     std::uint64_t readUInt64LE();
     std::uint64_t readVariableLengthUIntLE();
+    std::uint64_t readVarUInt64();
+    std::int64_t readVarInt64();
+    float readFloat16LE();
     float readFloat32LE();
     double readFloat64LE();
+    void readInt16BE(std::int16_t *values, std::size_t count);
+    void readUInt16BE(std::uint16_t *values, std::size_t count);
+    void readInt32BE(std::int32_t *values, std::size_t count);
+    void readUInt32BE(std::uint32_t *values, std::size_t count);
+    void readInt64BE(std::int64_t *values, std::size_t count);
+    void readUInt64BE(std::uint64_t *values, std::size_t count);
+    void readFloat32BE(float *values, std::size_t count);
+    void readFloat64BE(double *values, std::size_t count);
+    void readInt16LE(std::int16_t *values, std::size_t count);
+    void readUInt16LE(std::uint16_t *values, std::size_t count);
+    void readInt32LE(std::int32_t *values, std::size_t count);
+    void readUInt32LE(std::uint32_t *values, std::size_t count);
+    void readInt64LE(std::int64_t *values, std::size_t count);
+    void readUInt64LE(std::uint64_t *values, std::size_t count);
+    void readFloat32LE(float *values, std::size_t count);
+    void readFloat64LE(double *values, std::size_t count);
+    void readInt24BE(std::int32_t *values, std::size_t count);
+    void readInt24BE(float *values, std::size_t count);
+    void readInt24LE(std::int32_t *values, std::size_t count);
+    void readInt24LE(float *values, std::size_t count);
+    void readFloat16BE(float *values, std::size_t count);
+    void readFloat16LE(float *values, std::size_t count);
+    template <typename Record> Record readRecord();
+    template <typename Record> void readRecord(Record &record);
+    template <typename Record> void readRecords(Record *records, std::size_t count);
     char readChar();
     std::uint8_t readByte();
     bool readBool();
     std::string readLengthPrefixedString();
+    void readLengthPrefixedString(std::string &result);
     std::string readString(std::size_t length);
+    void readString(std::string &result, std::size_t length);
     std::string readTerminatedString(std::uint8_t termination = 0);
     std::string readTerminatedString(std::size_t maxBytesToRead, std::uint8_t termination = 0);
+    void readTerminatedString(std::string &result, std::uint8_t termination = 0);
+    void readTerminatedString(std::string &result, std::size_t maxBytesToRead, std::uint8_t termination = 0);
     std::uint32_t readSynchsafeUInt32BE();
     float readFixed8BE();
     float readFixed16BE();
@@ -92,11 +132,20 @@ public:
     void read(double &one64BitFloat);
 
 private:
+    void readData(char *buffer, std::streamsize size);
+    void cachePosition();
+    void cacheSize();
     void bufferVariableLengthInteger();
+    template <bool isBigEndian, typename ValueType> void readValues(ValueType *values, std::size_t count);
+    template <bool isBigEndian, typename ValueType> void readInt24Values(ValueType *values, std::size_t count);
 
     std::istream *m_stream;
     bool m_ownership;
+    bool m_positionCached;
+    bool m_sizeCached;
     char m_buffer[8];
+    std::uint64_t m_position;
+    std::uint64_t m_size;
 };
 
 /*!
@@ -107,6 +156,10 @@ private:
 inline BinaryReader::BinaryReader(std::istream *stream, bool giveOwnership)
     : m_stream(stream)
     , m_ownership(giveOwnership)
+    , m_positionCached(false)
+    , m_sizeCached(false)
+    , m_position(0)
+    , m_size(0)
 {
 }
 
@@ -117,6 +170,10 @@ inline BinaryReader::BinaryReader(std::istream *stream, bool giveOwnership)
 inline BinaryReader::BinaryReader(const BinaryReader &other)
     : m_stream(other.m_stream)
     , m_ownership(false)
+    , m_positionCached(false)
+    , m_sizeCached(other.m_sizeCached)
+    , m_position(0)
+    , m_size(other.m_size)
 {
 }
 
@@ -212,12 +269,82 @@ inline bool BinaryReader::canRead() const
     return m_stream && m_stream->good();
 }
 
+/*!
+ * \brief Returns the current position of the stream.
+ * \remarks
+ * - The position is determined via std::istream::tellg() only on the first call (and after invalidateCache()). Afterwards
+ *   it is tracked by the reader itself so no system calls are required.
+ * - Tracking only works as long as the stream is only read and seeked via the reader. Call invalidateCache() after using
+ *   the stream directly or after a read-method has thrown an exception.
+ */
+inline std::uint64_t BinaryReader::position()
+{
+    if (!m_positionCached) {
+        cachePosition();
+    }
+    return m_position;
+}
+
+/*!
+ * \brief Returns the size of the stream.
+ * \remarks
+ * - The size is only determined on the first call (and after invalidateCache()). If the stream is a NativeFileStream
+ *   referring to a regular file it is determined via fstat(); otherwise by seeking to the end of the stream and back.
+ * - Changes of the size (e.g. because the file is written to meanwhile) are not detected.
+ */
+inline std::uint64_t BinaryReader::size()
+{
+    if (!m_sizeCached) {
+        cacheSize();
+    }
+    return m_size;
+}
+
+/*!
+ * \brief Returns the number of bytes from the current position to the end of the stream.
+ * \remarks Uses the cached values of position() and size() so usually no system calls are required.
+ */
+inline std::uint64_t BinaryReader::remaining()
+{
+    const auto currentPosition = position();
+    const auto streamSize = size();
+    return currentPosition < streamSize ? streamSize - currentPosition : 0;
+}
+
+/*!
+ * \brief Sets the current position of the stream to the specified \a position keeping the cached position up-to-date.
+ */
+inline void BinaryReader::seek(std::uint64_t position)
+{
+    m_stream->seekg(static_cast<std::istream::off_type>(position));
+    m_position = position;
+    m_positionCached = !m_stream->fail();
+}
+
+/*!
+ * \brief Discards the cached position and size so they are determined again when calling position(), size() or remaining().
+ * \remarks Needs to be called after reading/seeking the stream without the reader so the tracked position is not wrong.
+ */
+inline void BinaryReader::invalidateCache()
+{
+    m_positionCached = m_sizeCached = false;
+}
+
+/*!
+ * \brief Reads \a size bytes from the stream into \a buffer and tracks the position.
+ */
+inline void BinaryReader::readData(char *buffer, std::streamsize size)
+{
+    m_stream->read(buffer, size);
+    m_position += static_cast<std::uint64_t>(m_stream->gcount());
+}
+
 /*!
  * \brief Reads the specified number of characters from the stream in the character array.
  */
 inline void BinaryReader::read(char *buffer, std::streamsize length)
 {
-    m_stream->read(buffer, length);
+    readData(buffer, length);
 }
 
 /*!
@@ -225,7 +352,7 @@ inline void BinaryReader::read(char *buffer, std::streamsize length)
  */
 inline void BinaryReader::read(std::uint8_t *buffer, std::streamsize length)
 {
-    m_stream->read(reinterpret_cast<char *>(buffer), length);
+    readData(reinterpret_cast<char *>(buffer), length);
 }
 
 /*!
@@ -234,7 +361,7 @@ inline void BinaryReader::read(std::uint8_t *buffer, std::streamsize length)
 inline void BinaryReader::read(std::vector<char> &buffer, std::streamsize length)
 {
     buffer.resize(static_cast<std::vector<char>::size_type>(length));
-    m_stream->read(buffer.data(), length);
+    readData(buffer.data(), length);
 }
 
 /*!
@@ -242,7 +369,7 @@ inline void BinaryReader::read(std::vector<char> &buffer, std::streamsize length
  */
 inline std::int16_t BinaryReader::readInt16BE()
 {
-    m_stream->read(m_buffer, sizeof(std::int16_t));
+    readData(m_buffer, sizeof(std::int16_t));
     return BE::toInt<std::int16_t>(m_buffer);
 }
 
@@ -251,7 +378,7 @@ inline std::int16_t BinaryReader::readInt16BE()
  */
 inline std::uint16_t BinaryReader::readUInt16BE()
 {
-    m_stream->read(m_buffer, sizeof(std::uint16_t));
+    readData(m_buffer, sizeof(std::uint16_t));
     return BE::toInt<std::uint16_t>(m_buffer);
 }
 
@@ -261,7 +388,7 @@ inline std::uint16_t BinaryReader::readUInt16BE()
 inline std::int32_t BinaryReader::readInt24BE()
 {
     *m_buffer = 0;
-    m_stream->read(m_buffer + 1, 3);
+    readData(m_buffer + 1, 3);
     auto val = BE::toInt<std::int32_t>(m_buffer);
     if (val >= 0x800000) {
         val = -(0x1000000 - val);
@@ -275,7 +402,7 @@ inline std::int32_t BinaryReader::readInt24BE()
 inline std::uint32_t BinaryReader::readUInt24BE()
 {
     *m_buffer = 0;
-    m_stream->read(m_buffer + 1, 3);
+    readData(m_buffer + 1, 3);
     return BE::toInt<std::uint32_t>(m_buffer);
 }
 
@@ -284,7 +411,7 @@ inline std::uint32_t BinaryReader::readUInt24BE()
  */
 inline std::int32_t BinaryReader::readInt32BE()
 {
-    m_stream->read(m_buffer, sizeof(std::int32_t));
+    readData(m_buffer, sizeof(std::int32_t));
     return BE::toInt<std::int32_t>(m_buffer);
 }
 
@@ -293,7 +420,7 @@ inline std::int32_t BinaryReader::readInt32BE()
  */
 inline std::uint32_t BinaryReader::readUInt32BE()
 {
-    m_stream->read(m_buffer, sizeof(std::uint32_t));
+    readData(m_buffer, sizeof(std::uint32_t));
     return BE::toInt<std::uint32_t>(m_buffer);
 }
 
@@ -303,7 +430,7 @@ inline std::uint32_t BinaryReader::readUInt32BE()
 inline std::int64_t BinaryReader::readInt40BE()
 {
     *m_buffer = *(m_buffer + 1) = *(m_buffer + 2) = 0;
-    m_stream->read(m_buffer + 3, 5);
+    readData(m_buffer + 3, 5);
     auto val = BE::toInt<std::int64_t>(m_buffer);
     if (val >= 0x8000000000) {
         val = -(0x10000000000 - val);
@@ -317,7 +444,7 @@ inline std::int64_t BinaryReader::readInt40BE()
 inline std::uint64_t BinaryReader::readUInt40BE()
 {
     *m_buffer = *(m_buffer + 1) = *(m_buffer + 2) = 0;
-    m_stream->read(m_buffer + 3, 5);
+    readData(m_buffer + 3, 5);
     return BE::toInt<std::uint64_t>(m_buffer);
 }
 
@@ -327,7 +454,7 @@ inline std::uint64_t BinaryReader::readUInt40BE()
 inline std::int64_t BinaryReader::readInt56BE()
 {
     *m_buffer = 0;
-    m_stream->read(m_buffer + 1, 7);
+    readData(m_buffer + 1, 7);
     auto val = BE::toInt<std::int64_t>(m_buffer);
     if (val >= 0x80000000000000) {
         val = -(0x100000000000000 - val);
@@ -341,7 +468,7 @@ inline std::int64_t BinaryReader::readInt56BE()
 inline std::uint64_t BinaryReader::readUInt56BE()
 {
     *m_buffer = 0;
-    m_stream->read(m_buffer + 1, 7);
+    readData(m_buffer + 1, 7);
     return BE::toInt<std::uint64_t>(m_buffer);
 }
 
@@ -350,7 +477,7 @@ inline std::uint64_t BinaryReader::readUInt56BE()
  */
 inline std::int64_t BinaryReader::readInt64BE()
 {
-    m_stream->read(m_buffer, sizeof(std::int64_t));
+    readData(m_buffer, sizeof(std::int64_t));
     return BE::toInt<std::int64_t>(m_buffer);
 }
 
@@ -359,18 +486,18 @@ inline std::int64_t BinaryReader::readInt64BE()
  */
 inline std::uint64_t BinaryReader::readUInt64BE()
 {
-    m_stream->read(m_buffer, sizeof(std::uint64_t));
+    readData(m_buffer, sizeof(std::uint64_t));
     return BE::toInt<std::uint64_t>(m_buffer);
 }
 
 /*!
- * \brief Reads an up to 8 byte long big endian unsigned integer from the current stream and advances the current position of the stream by one to eight byte.
- * \throws Throws ConversionException if the size of the integer exceeds the maximum.
+ * \brief Reads a 16-bit big endian floating point value (IEEE-754 binary16) from the current stream and advances the current position of
+ *        the stream by two bytes.
  */
-inline std::uint64_t BinaryReader::readVariableLengthUIntBE()
+inline float BinaryReader::readFloat16BE()
 {
-    bufferVariableLengthInteger();
-    return BE::toInt<std::uint64_t>(m_buffer);
+    readData(m_buffer, 2);
+    return BE::toFloat16(m_buffer);
 }
 
 /*!
@@ -378,7 +505,7 @@ inline std::uint64_t BinaryReader::readVariableLengthUIntBE()
  */
 inline float BinaryReader::readFloat32BE()
 {
-    m_stream->read(m_buffer, sizeof(float));
+    readData(m_buffer, sizeof(float));
     return BE::toFloat32(m_buffer);
 }
 
@@ -387,7 +514,7 @@ inline float BinaryReader::readFloat32BE()
  */
 inline double BinaryReader::readFloat64BE()
 {
-    m_stream->read(m_buffer, sizeof(double));
+    readData(m_buffer, sizeof(double));
     return BE::toFloat64(m_buffer);
 }
 
@@ -396,7 +523,7 @@ inline double BinaryReader::readFloat64BE()
  */
 inline std::int16_t BinaryReader::readInt16LE()
 {
-    m_stream->read(m_buffer, sizeof(std::int16_t));
+    readData(m_buffer, sizeof(std::int16_t));
     return LE::toInt<std::int16_t>(m_buffer);
 }
 
@@ -405,7 +532,7 @@ inline std::int16_t BinaryReader::readInt16LE()
  */
 inline std::uint16_t BinaryReader::readUInt16LE()
 {
-    m_stream->read(m_buffer, sizeof(std::uint16_t));
+    readData(m_buffer, sizeof(std::uint16_t));
     return LE::toInt<std::uint16_t>(m_buffer);
 }
 
@@ -415,7 +542,7 @@ inline std::uint16_t BinaryReader::readUInt16LE()
 inline std::int32_t BinaryReader::readInt24LE()
 {
     *(m_buffer + 3) = 0;
-    m_stream->read(m_buffer, 3);
+    readData(m_buffer, 3);
     auto val = LE::toInt<std::int32_t>(m_buffer);
     if (val >= 0x800000) {
         val = -(0x1000000 - val);
@@ -429,7 +556,7 @@ inline std::int32_t BinaryReader::readInt24LE()
 inline std::uint32_t BinaryReader::readUInt24LE()
 {
     *(m_buffer + 3) = 0;
-    m_stream->read(m_buffer, 3);
+    readData(m_buffer, 3);
     return LE::toInt<std::uint32_t>(m_buffer);
 }
 
@@ -438,7 +565,7 @@ inline std::uint32_t BinaryReader::readUInt24LE()
  */
 inline std::int32_t BinaryReader::readInt32LE()
 {
-    m_stream->read(m_buffer, sizeof(std::int32_t));
+    readData(m_buffer, sizeof(std::int32_t));
     return LE::toInt<std::int32_t>(m_buffer);
 }
 
@@ -447,7 +574,7 @@ inline std::int32_t BinaryReader::readInt32LE()
  */
 inline std::uint32_t BinaryReader::readUInt32LE()
 {
-    m_stream->read(m_buffer, sizeof(std::uint32_t));
+    readData(m_buffer, sizeof(std::uint32_t));
     return LE::toInt<std::uint32_t>(m_buffer);
 }
 
@@ -457,7 +584,7 @@ inline std::uint32_t BinaryReader::readUInt32LE()
 inline std::int64_t BinaryReader::readInt40LE()
 {
     *(m_buffer + 5) = *(m_buffer + 6) = *(m_buffer + 7) = 0;
-    m_stream->read(m_buffer, 5);
+    readData(m_buffer, 5);
     auto val = LE::toInt<std::int64_t>(m_buffer);
     if (val >= 0x8000000000) {
         val = -(0x10000000000 - val);
@@ -471,7 +598,7 @@ inline std::int64_t BinaryReader::readInt40LE()
 inline std::uint64_t BinaryReader::readUInt40LE()
 {
     *(m_buffer + 5) = *(m_buffer + 6) = *(m_buffer + 7) = 0;
-    m_stream->read(m_buffer, 5);
+    readData(m_buffer, 5);
     return LE::toInt<std::uint64_t>(m_buffer);
 }
 
@@ -481,7 +608,7 @@ inline std::uint64_t BinaryReader::readUInt40LE()
 inline std::int64_t BinaryReader::readInt56LE()
 {
     *(m_buffer + 7) = 0;
-    m_stream->read(m_buffer, 7);
+    readData(m_buffer, 7);
     auto val = LE::toInt<std::int64_t>(m_buffer);
     if (val >= 0x80000000000000) {
         val = -(0x100000000000000 - val);
@@ -495,7 +622,7 @@ inline std::int64_t BinaryReader::readInt56LE()
 inline std::uint64_t BinaryReader::readUInt56LE()
 {
     *(m_buffer + 7) = 0;
-    m_stream->read(m_buffer, 7);
+    readData(m_buffer, 7);
     return LE::toInt<std::uint64_t>(m_buffer);
 }
 
@@ -504,7 +631,7 @@ inline std::uint64_t BinaryReader::readUInt56LE()
  */
 inline std::int64_t BinaryReader::readInt64LE()
 {
-    m_stream->read(m_buffer, sizeof(std::int64_t));
+    readData(m_buffer, sizeof(std::int64_t));
     return LE::toInt<std::int64_t>(m_buffer);
 }
 
@@ -513,7 +640,7 @@ inline std::int64_t BinaryReader::readInt64LE()
  */
 inline std::uint64_t BinaryReader::readUInt64LE()
 {
-    m_stream->read(m_buffer, sizeof(std::uint64_t));
+    readData(m_buffer, sizeof(std::uint64_t));
     return LE::toInt<std::uint64_t>(m_buffer);
 }
 
@@ -527,12 +654,33 @@ inline std::uint64_t BinaryReader::readVariableLengthUIntLE()
     return LE::toInt<std::uint64_t>(m_buffer);
 }
 
+/*!
+ * \brief Reads a ZigZag and LEB128 encoded signed integer from the current stream and advances the current position of the stream by one to ten bytes.
+ * \throws Throws ConversionException if the integer exceeds 64 bit and std::ios_base::failure if the stream ends within
+ *         the integer.
+ * \sa readVarUInt64(), fromZigZagInt()
+ */
+inline std::int64_t BinaryReader::readVarInt64()
+{
+    return fromZigZagInt(readVarUInt64());
+}
+
+/*!
+ * \brief Reads a 16-bit little endian floating point value (IEEE-754 binary16) from the current stream and advances the current position
+ *        of the stream by two bytes.
+ */
+inline float BinaryReader::readFloat16LE()
+{
+    readData(m_buffer, 2);
+    return LE::toFloat16(m_buffer);
+}
+
 /*!
  * \brief Reads a 32-bit little endian floating point value from the current stream and advances the current position of the stream by four bytes.
  */
 inline float BinaryReader::readFloat32LE()
 {
-    m_stream->read(m_buffer, sizeof(float));
+    readData(m_buffer, sizeof(float));
     return LE::toFloat32(m_buffer);
 }
 
@@ -541,16 +689,281 @@ inline float BinaryReader::readFloat32LE()
  */
 inline double BinaryReader::readFloat64LE()
 {
-    m_stream->read(m_buffer, sizeof(double));
+    readData(m_buffer, sizeof(double));
     return LE::toFloat64(m_buffer);
 }
 
+/*!
+ * \brief Reads \a count values of the specified \a ValueType with the specified byte order into \a values.
+ * \remarks Reads all values with one call of std::istream::read() and converts the byte order afterwards in-place
+ *          using swapOrder() for arrays.
+ */
+template <bool isBigEndian, typename ValueType> inline void BinaryReader::readValues(ValueType *values, std::size_t count)
+{
+    readData(reinterpret_cast<char *>(values), static_cast<std::streamsize>(count * sizeof(ValueType)));
+    if constexpr (isBigEndian != CONVERSION_UTILITIES_IS_BYTE_ORDER_BIG_ENDIAN) {
+        swapOrder(values, count);
+    }
+}
+
+/*!
+ * \brief Reads \a count 16-bit big endian signed integers from the current stream into \a values and advances the current position
+ *        of the stream by \a count times the size of a single value.
+ */
+inline void BinaryReader::readInt16BE(std::int16_t *values, std::size_t count)
+{
+    readValues<true>(values, count);
+}
+
+/*!
+ * \brief Reads \a count 16-bit big endian unsigned integers from the current stream into \a values and advances the current position
+ *        of the stream by \a count times the size of a single value.
+ */
+inline void BinaryReader::readUInt16BE(std::uint16_t *values, std::size_t count)
+{
+    readValues<true>(values, count);
+}
+
+/*!
+ * \brief Reads \a count 32-bit big endian signed integers from the current stream into \a values and advances the current position
+ *        of the stream by \a count times the size of a single value.
+ */
+inline void BinaryReader::readInt32BE(std::int32_t *values, std::size_t count)
+{
+    readValues<true>(values, count);
+}
+
+/*!
+ * \brief Reads \a count 32-bit big endian unsigned integers from the current stream into \a values and advances the current position
+ *        of the stream by \a count times the size of a single value.
+ */
+inline void BinaryReader::readUInt32BE(std::uint32_t *values, std::size_t count)
+{
+    readValues<true>(values, count);
+}
+
+/*!
+ * \brief Reads \a count 64-bit big endian signed integers from the current stream into \a values and advances the current position
+ *        of the stream by \a count times the size of a single value.
+ */
+inline void BinaryReader::readInt64BE(std::int64_t *values, std::size_t count)
+{
+    readValues<true>(values, count);
+}
+
+/*!
+ * \brief Reads \a count 64-bit big endian unsigned integers from the current stream into \a values and advances the current position
+ *        of the stream by \a count times the size of a single value.
+ */
+inline void BinaryReader::readUInt64BE(std::uint64_t *values, std::size_t count)
+{
+    readValues<true>(values, count);
+}
+
+/*!
+ * \brief Reads \a count 32-bit big endian floating point values from the current stream into \a values and advances the current position
+ *        of the stream by \a count times the size of a single value.
+ */
+inline void BinaryReader::readFloat32BE(float *values, std::size_t count)
+{
+    readValues<true>(values, count);
+}
+
+/*!
+ * \brief Reads \a count 64-bit big endian floating point values from the current stream into \a values and advances the current position
+ *        of the stream by \a count times the size of a single value.
+ */
+inline void BinaryReader::readFloat64BE(double *values, std::size_t count)
+{
+    readValues<true>(values, count);
+}
+
+/*!
+ * \brief Reads \a count 16-bit little endian signed integers from the current stream into \a values and advances the current position
+ *        of the stream by \a count times the size of a single value.
+ */
+inline void BinaryReader::readInt16LE(std::int16_t *values, std::size_t count)
+{
+    readValues<false>(values, count);
+}
+
+/*!
+ * \brief Reads \a count 16-bit little endian unsigned integers from the current stream into \a values and advances the current position
+ *        of the stream by \a count times the size of a single value.
+ */
+inline void BinaryReader::readUInt16LE(std::uint16_t *values, std::size_t count)
+{
+    readValues<false>(values, count);
+}
+
+/*!
+ * \brief Reads \a count 32-bit little endian signed integers from the current stream into \a values and advances the current position
+ *        of the stream by \a count times the size of a single value.
+ */
+inline void BinaryReader::readInt32LE(std::int32_t *values, std::size_t count)
+{
+    readValues<false>(values, count);
+}
+
+/*!
+ * \brief Reads \a count 32-bit little endian unsigned integers from the current stream into \a values and advances the current position
+ *        of the stream by \a count times the size of a single value.
+ */
+inline void BinaryReader::readUInt32LE(std::uint32_t *values, std::size_t count)
+{
+    readValues<false>(values, count);
+}
+
+/*!
+ * \brief Reads \a count 64-bit little endian signed integers from the current stream into \a values and advances the current position
+ *        of the stream by \a count times the size of a single value.
+ */
+inline void BinaryReader::readInt64LE(std::int64_t *values, std::size_t count)
+{
+    readValues<false>(values, count);
+}
+
+/*!
+ * \brief Reads \a count 64-bit little endian unsigned integers from the current stream into \a values and advances the current position
+ *        of the stream by \a count times the size of a single value.
+ */
+inline void BinaryReader::readUInt64LE(std::uint64_t *values, std::size_t count)
+{
+    readValues<false>(values, count);
+}
+
+/*!
+ * \brief Reads \a count 32-bit little endian floating point values from the current stream into \a values and advances the current position
+ *        of the stream by \a count times the size of a single value.
+ */
+inline void BinaryReader::readFloat32LE(float *values, std::size_t count)
+{
+    readValues<false>(values, count);
+}
+
+/*!
+ * \brief Reads \a count 64-bit little endian floating point values from the current stream into \a values and advances the current position
+ *        of the stream by \a count times the size of a single value.
+ */
+inline void BinaryReader::readFloat64LE(double *values, std::size_t count)
+{
+    readValues<false>(values, count);
+}
+
+/*!
+ * \brief Reads \a count packed 24-bit values with the specified byte order into \a values.
+ * \remarks
+ * - Reads the data in chunks of about 4 KiB on the stack and converts each chunk via BE::toInt24s() or LE::toInt24s().
+ * - If the end of the stream is reached, only the values which have been read completely are stored; the remaining
+ *   elements of \a values are left untouched.
+ */
+template <bool isBigEndian, typename ValueType> inline void BinaryReader::readInt24Values(ValueType *values, std::size_t count)
+{
+    constexpr std::size_t chunkSize = 4095 / 3;
+    char chunk[chunkSize * 3];
+    for (std::size_t chunkCount; count; count -= chunkCount, values += chunkCount) {
+        chunkCount = std::min(count, chunkSize);
+        readData(chunk, static_cast<std::streamsize>(chunkCount * 3));
+        const auto valuesRead = static_cast<std::size_t>(m_stream->gcount()) / 3;
+        if constexpr (isBigEndian) {
+            BE::toInt24s(chunk, values, valuesRead);
+        } else {
+            LE::toInt24s(chunk, values, valuesRead);
+        }
+        if (valuesRead != chunkCount) {
+            return;
+        }
+    }
+}
+
+/*!
+ * \brief Reads \a count packed 24-bit big endian signed integers (e.g. PCM samples) from the current stream into \a values and
+ *        advances the current position of the stream by \a count times three bytes.
+ */
+inline void BinaryReader::readInt24BE(std::int32_t *values, std::size_t count)
+{
+    readInt24Values<true>(values, count);
+}
+
+/*!
+ * \brief Reads \a count packed 24-bit big endian signed integers (e.g. PCM samples) from the current stream into \a values
+ *        normalized to [-1, 1) and advances the current position of the stream by \a count times three bytes.
+ */
+inline void BinaryReader::readInt24BE(float *values, std::size_t count)
+{
+    readInt24Values<true>(values, count);
+}
+
+/*!
+ * \brief Reads \a count packed 24-bit little endian signed integers (e.g. PCM samples) from the current stream into \a values and
+ *        advances the current position of the stream by \a count times three bytes.
+ */
+inline void BinaryReader::readInt24LE(std::int32_t *values, std::size_t count)
+{
+    readInt24Values<false>(values, count);
+}
+
+/*!
+ * \brief Reads \a count packed 24-bit little endian signed integers (e.g. PCM samples) from the current stream into \a values
+ *        normalized to [-1, 1) and advances the current position of the stream by \a count times three bytes.
+ */
+inline void BinaryReader::readInt24LE(float *values, std::size_t count)
+{
+    readInt24Values<false>(values, count);
+}
+
+/*!
+ * \brief Reads \a count 16-bit big endian floating point values (IEEE-754 binary16) from the current stream into \a values and advances
+ *        the current position of the stream by \a count times two bytes.
+ * \remarks
+ * - Reads the data in chunks of 4 KiB on the stack and converts each chunk via BE::toFloat16s().
+ * - If the end of the stream is reached, only the values which have been read completely are stored; the remaining
+ *   elements of \a values are left untouched.
+ */
+inline void BinaryReader::readFloat16BE(float *values, std::size_t count)
+{
+    constexpr std::size_t chunkSize = 2048;
+    char chunk[chunkSize * 2];
+    for (std::size_t chunkCount; count; count -= chunkCount, values += chunkCount) {
+        chunkCount = std::min(count, chunkSize);
+        readData(chunk, static_cast<std::streamsize>(chunkCount * 2));
+        const auto valuesRead = static_cast<std::size_t>(m_stream->gcount()) / 2;
+        BE::toFloat16s(chunk, values, valuesRead);
+        if (valuesRead != chunkCount) {
+            return;
+        }
+    }
+}
+
+/*!
+ * \brief Reads \a count 16-bit little endian floating point values (IEEE-754 binary16) from the current stream into \a values and
+ *        advances the current position of the stream by \a count times two bytes.
+ * \remarks
+ * - Reads the data in chunks of 4 KiB on the stack and converts each chunk via LE::toFloat16s().
+ * - If the end of the stream is reached, only the values which have been read completely are stored; the remaining
+ *   elements of \a values are left untouched.
+ */
+inline void BinaryReader::readFloat16LE(float *values, std::size_t count)
+{
+    constexpr std::size_t chunkSize = 2048;
+    char chunk[chunkSize * 2];
+    for (std::size_t chunkCount; count; count -= chunkCount, values += chunkCount) {
+        chunkCount = std::min(count, chunkSize);
+        readData(chunk, static_cast<std::streamsize>(chunkCount * 2));
+        const auto valuesRead = static_cast<std::size_t>(m_stream->gcount()) / 2;
+        LE::toFloat16s(chunk, values, valuesRead);
+        if (valuesRead != chunkCount) {
+            return;
+        }
+    }
+}
+
 /*!
  * \brief Reads a single character from the current stream and advances the current position of the stream by one byte.
  */
 inline char BinaryReader::readChar()
 {
-    m_stream->read(m_buffer, sizeof(char));
+    readData(m_buffer, sizeof(char));
     return m_buffer[0];
 }
 
@@ -559,7 +972,7 @@ inline char BinaryReader::readChar()
  */
 inline uint8_t BinaryReader::readByte()
 {
-    m_stream->read(m_buffer, sizeof(char));
+    readData(m_buffer, sizeof(char));
     return static_cast<std::uint8_t>(m_buffer[0]);
 }
 
@@ -582,6 +995,18 @@ inline std::string BinaryReader::readLengthPrefixedString()
     return readString(readVariableLengthUIntBE());
 }
 
+/*!
+ * \brief Reads a length prefixed string from the current stream into \a result.
+ * \remarks
+ * - Reads the length prefix from the stream and then a string of the denoted length.
+ * - Advances the current position of the stream by the denoted length of the string plus the prefix length.
+ * - The capacity of \a result is reused so no allocation happens if it is already big enough.
+ */
+inline void BinaryReader::readLengthPrefixedString(std::string &result)
+{
+    readString(result, readVariableLengthUIntBE());
+}
+
 /*!
  * \brief Reads a 32-bit big endian synchsafe integer from the current stream and advances the current position of the stream by four bytes.
  * \remarks Synchsafe integers appear in ID3 tags that are attached to an MP3 file.
@@ -667,7 +1092,7 @@ inline void BinaryReader::read(bool &oneBool)
  */
 inline void BinaryReader::read(std::string &lengthPrefixedString)
 {
-    lengthPrefixedString = readLengthPrefixedString();
+    readLengthPrefixedString(lengthPrefixedString);
 }
 
 /*!
@@ -733,6 +1158,49 @@ inline void BinaryReader::read(double &one64BitFloat)
 {
     one64BitFloat = readFloat64BE();
 }
+
+/*!
+ * \brief Reads a record of the specified type from the current stream and advances the current position of the stream by
+ *        the size of the record.
+ * \remarks The record is read with one call of std::istream::read() and decoded according to its RecordSchema.
+ */
+template <typename Record> inline Record BinaryReader::readRecord()
+{
+    auto record = Record();
+    readRecord(record);
+    return record;
+}
+
+/*!
+ * \brief Reads a record of the specified type from the current stream into \a record and advances the current position of
+ *        the stream by the size of the record.
+ * \remarks The record is read with one call of std::istream::read() and decoded according to its RecordSchema.
+ */
+template <typename Record> inline void BinaryReader::readRecord(Record &record)
+{
+    char buffer[recordSize<Record>];
+    readData(buffer, static_cast<std::streamsize>(recordSize<Record>));
+    decodeRecord(buffer, record);
+}
+
+/*!
+ * \brief Reads \a count records of the specified type from the current stream into \a records and advances the current position
+ *        of the stream by \a count times the size of a single record.
+ * \remarks The records are read in chunks of about 4 KiB so only one call of std::istream::read() is required per chunk.
+ */
+template <typename Record> void BinaryReader::readRecords(Record *records, std::size_t count)
+{
+    constexpr auto chunkSize = Detail::recordsPerChunk<Record>();
+    char chunk[chunkSize * recordSize<Record>];
+    for (std::size_t chunkCount; count; count -= chunkCount) {
+        chunkCount = std::min(count, chunkSize);
+        readData(chunk, static_cast<std::streamsize>(chunkCount * recordSize<Record>));
+        for (const auto *i = chunk, *end = chunk + chunkCount * recordSize<Record>; i != end; i += recordSize<Record>) {
+            decodeRecord(i, *records++);
+        }
+    }
+}
+
 } // namespace CppUtilities
 
 #endif // IOUTILITIES_BINERYREADER_H
@@ -1,9 +1,21 @@
 #include "./binarywriter.h"
+#include "./nativefilestream.h"
 
 #include "../conversion/conversionexception.h"
 
+#include <algorithm>
+#include <cerrno>
 #include <cstring>
+#include <ios>
 #include <memory>
+#include <system_error>
+
+#if defined(CPP_UTILITIES_USE_NATIVE_FILE_BUFFER) && defined(PLATFORM_UNIX)
+#define CPP_UTILITIES_BINARY_WRITER_USE_POSIX_IO
+#include <climits>
+#include <sys/uio.h>
+#include <unistd.h>
+#endif
 
 using namespace std;
 
@@ -13,6 +25,13 @@ namespace CppUtilities {
  * \class BinaryWriter
  * \brief Writes primitive data types to a std::ostream.
  * \remarks Supports both, little endian and big endian.
+ *
+ * By default, each write-method calls std::ostream::write() of the assigned stream. When serializing many small fields
+ * the overhead of these calls can be avoided by enabling an internal write buffer via setWriteBufferSize(). Data is then
+ * collected in that buffer and written to the stream in large blocks when the buffer is full, on flush(), flushWriteBuffer(),
+ * setStream() and on destruction. When a write buffer is used, flushWriteBuffer() must be called before accessing the
+ * assigned stream directly (e.g. for seeking).
+ *
  * \sa For automatic deserialization of structs, see https://github.com/Martchus/reflective-rapidjson.
  */
 
@@ -23,12 +42,18 @@ namespace CppUtilities {
  * until a stream is assigned.
  *
  * \param stream Specifies the stream to be assigned.
+ * \remarks Data pending in the write buffer is written to the previously assigned stream.
  * \param giveOwnership Specifies whether the writer should take ownership.
  *
  * \sa setStream()
  */
 void BinaryWriter::setStream(ostream *stream, bool giveOwnership)
 {
+    if (m_writeBufferUsed && m_stream) {
+        drainWriteBuffer();
+    }
+    m_writeBufferUsed = 0;
+    m_drainedBytes = 0;
     if (m_ownership) {
         delete m_stream;
     }
@@ -57,7 +82,239 @@ void BinaryWriter::writeVariableLengthInteger(std::uint64_t value, void (*getByt
     if (prefixLength == 9) {
         throw ConversionException("The variable-length integer to be written exceeds the maximum.");
     }
-    m_stream->write(m_buffer + 8 - prefixLength, prefixLength);
+    writeData(m_buffer + 8 - prefixLength, prefixLength);
+}
+
+/*!
+ * \brief Sets the size of the write buffer.
+ *
+ * Specify a non-zero \a bufferSize to enable buffering of written data within the writer itself. This avoids the overhead
+ * of calling std::ostream::write() for each field. Specify zero to disable the write buffer again (the default).
+ *
+ * \remarks Data pending in the current write buffer is written to the assigned stream before changing the size.
+ * \sa The class documentation of BinaryWriter for details.
+ */
+void BinaryWriter::setWriteBufferSize(std::size_t bufferSize)
+{
+    flushWriteBuffer();
+    if (bufferSize == m_writeBufferSize) {
+        return;
+    }
+    m_writeBuffer = bufferSize ? std::make_unique<char[]>(bufferSize) : nullptr;
+    m_writeBufferSize = bufferSize;
+}
+
+/*!
+ * \brief Writes the specified \a data which does not fit into the write buffer (or no write buffer is used).
+ *
+ * Pending data is written to the stream first. Then \a data is appended to the now empty write buffer unless it is as
+ * least as big as the write buffer in which case it is written directly.
+ */
+void BinaryWriter::writeDataUnbuffered(const char *data, std::size_t size)
+{
+    if (m_writeBufferUsed) {
+        drainWriteBuffer();
+    }
+    if (size < m_writeBufferSize) {
+        std::memcpy(m_writeBuffer.get(), data, size);
+        m_writeBufferUsed = size;
+    } else {
+        m_drainedBytes += size;
+        m_stream->write(data, static_cast<std::streamsize>(size));
+    }
+}
+
+/*!
+ * \brief Writes the specified \a pieces one after another.
+ *
+ * This is useful when the data to be written is already present in separate buffers, e.g. a header, a big payload and
+ * padding. If the assigned stream is a NativeFileStream (under UNIX), the pieces are written via a single writev() call
+ * (or a few if there are very many pieces) directly to the file descriptor instead of being copied through the write
+ * buffer and the buffer of the stream. Otherwise the pieces are simply written one after another.
+ *
+ * \remarks Data pending in the write buffer and in the buffer of the stream is written before.
+ * \throws Throws std::ios_base::failure if writev() fails. Otherwise errors are reported as usual via the state of
+ *         the assigned stream.
+ */
+void BinaryWriter::writeGather(const std::string_view *pieces, std::size_t count)
+{
+#ifdef CPP_UTILITIES_BINARY_WRITER_USE_POSIX_IO
+    auto *const nativeFileStream = dynamic_cast<NativeFileStream *>(m_stream);
+    if (!nativeFileStream || nativeFileStream->fileDescriptor() == -1) {
+#endif
+        for (const auto *piece = pieces, *end = pieces + count; piece != end; ++piece) {
+            writeData(piece->data(), piece->size());
+        }
+#ifdef CPP_UTILITIES_BINARY_WRITER_USE_POSIX_IO
+        return;
+    }
+
+    // ensure the file offset is at the logical position of the stream (if the file is seekable at all)
+    flush();
+    const auto fileDescriptor = nativeFileStream->fileDescriptor();
+    const auto position = m_stream->tellp();
+    if (position != std::ostream::pos_type(-1) && ::lseek(fileDescriptor, static_cast<off_t>(position), SEEK_SET) == -1) {
+        throw std::ios_base::failure("lseek failed", std::error_code(errno, std::system_category()));
+    }
+
+    // write the pieces in chunks of at most IOV_MAX pieces resuming partial writes
+    constexpr auto maxVectors = std::size_t(IOV_MAX < 1024 ? IOV_MAX : 1024);
+    iovec vectors[maxVectors];
+    auto error = std::error_code();
+    for (std::size_t chunkSize; count && !error; count -= chunkSize, pieces += chunkSize) {
+        chunkSize = std::min(count, maxVectors);
+        auto vectorCount = std::size_t();
+        for (const auto *piece = pieces, *end = pieces + chunkSize; piece != end; ++piece) {
+            if (!piece->empty()) {
+                vectors[vectorCount].iov_base = const_cast<char *>(piece->data());
+                vectors[vectorCount++].iov_len = piece->size();
+            }
+        }
+        for (auto *vector = vectors, *end = vectors + vectorCount; vector != end;) {
+            const auto bytesWritten = ::writev(fileDescriptor, vector, static_cast<int>(end - vector));
+            if (bytesWritten < 0) {
+                if (errno == EINTR) {
+                    continue;
+                }
+                error = std::error_code(errno, std::system_category());
+                break;
+            }
+            auto remaining = static_cast<std::size_t>(bytesWritten);
+            m_drainedBytes += remaining;
+            for (; vector != end && remaining >= vector->iov_len; ++vector) {
+                remaining -= vector->iov_len;
+            }
+            if (vector != end) {
+                vector->iov_base = static_cast<char *>(vector->iov_base) + remaining;
+                vector->iov_len -= remaining;
+            }
+        }
+    }
+
+    // move the stream to the end of the written data (which is not necessarily position + size in append mode)
+    if (position != std::ostream::pos_type(-1)) {
+        if (const auto newPosition = ::lseek(fileDescriptor, 0, SEEK_CUR); newPosition != -1) {
+            m_stream->seekp(std::ostream::pos_type(newPosition));
+        }
+    }
+    if (error) {
+        throw std::ios_base::failure("writev failed", error);
+    }
+#endif
+}
+
+/*!
+ * \brief Reserves a field with \a size bytes using the specified \a encoding which is written later via resolvePlaceholder().
+ */
+BinaryWriter::Placeholder BinaryWriter::reservePlaceholder(std::uint8_t size, Placeholder::Encoding encoding)
+{
+    if (size < 1 || size > 8) {
+        throw ConversionException("The size of the placeholder is not supported.");
+    }
+    const auto placeholder = Placeholder{ writtenBytes(), size, encoding };
+    std::memset(m_buffer, 0, sizeof(m_buffer));
+    writeData(m_buffer, size);
+    return placeholder;
+}
+
+/*!
+ * \brief Writes \a value into the field the specified \a placeholder refers to.
+ *
+ * This allows writing length-prefixed structures (e.g. MP4 atoms, EBML elements or RIFF chunks) without seeking back and
+ * forth for each element:
+ * ```
+ * const auto sizeField = writer.reserveUIntBE(4);
+ * writer.writeString("moov");
+ * // ... write the children ...
+ * writer.resolvePlaceholder(sizeField, writer.writtenBytes() - sizeField.offset);
+ * ```
+ *
+ * If the field is still within the write buffer (see setWriteBufferSize()), it is simply updated in memory. So no IO is
+ * required at all if the write buffer is big enough to hold the whole element. Otherwise the field is written via pwrite()
+ * if the assigned stream is a NativeFileStream (under UNIX) and by seeking back and forth as a last resort.
+ *
+ * \remarks
+ * - The \a placeholder must have been reserved since the current stream has been assigned.
+ * - The data written since reserving \a placeholder must have been written via the writer and the stream must not
+ *   have been moved meanwhile (except by writeGather()).
+ * - Placeholders can be resolved in any order so nested elements can be written in one pass.
+ * \throws
+ * - Throws ConversionException if \a value does not fit into the field.
+ * - Throws std::ios_base::failure if pwrite() fails. Otherwise errors are reported as usual via the state of the assigned
+ *   stream.
+ */
+void BinaryWriter::resolvePlaceholder(const Placeholder &placeholder, std::uint64_t value)
+{
+    const auto size = placeholder.size;
+    const auto bits = size * 8u;
+    switch (placeholder.encoding) {
+    case Placeholder::Encoding::VariableLengthBigEndian:
+        if (value >= (std::uint64_t(1) << (size * 7u))) {
+            throw ConversionException("The variable-length integer to be written exceeds the maximum of the placeholder.");
+        }
+        value |= std::uint64_t(1) << (size * 7u);
+        [[fallthrough]];
+    case Placeholder::Encoding::BigEndian:
+        if (bits < 64 && (value >> bits)) {
+            throw ConversionException("The integer to be written exceeds the maximum of the placeholder.");
+        }
+        BE::getBytes(value, m_buffer);
+        break;
+    case Placeholder::Encoding::LittleEndian:
+        if (bits < 64 && (value >> bits)) {
+            throw ConversionException("The integer to be written exceeds the maximum of the placeholder.");
+        }
+        LE::getBytes(value, m_buffer);
+        break;
+    }
+    const auto *const data = placeholder.encoding == Placeholder::Encoding::LittleEndian ? m_buffer : m_buffer + 8 - size;
+
+    // update the field within the write buffer if it has not been drained yet
+    if (placeholder.offset >= m_drainedBytes) {
+        std::memcpy(m_writeBuffer.get() + (placeholder.offset - m_drainedBytes), data, size);
+        return;
+    }
+
+    // write the field directly to the file
+    const auto distance = static_cast<std::ostream::off_type>(m_drainedBytes - placeholder.offset);
+#ifdef CPP_UTILITIES_BINARY_WRITER_USE_POSIX_IO
+    if (auto *const nativeFileStream = dynamic_cast<NativeFileStream *>(m_stream); nativeFileStream && nativeFileStream->fileDescriptor() != -1) {
+        m_stream->flush();
+        if (const auto position = m_stream->tellp(); position != std::ostream::pos_type(-1)) {
+            auto offset = static_cast<off_t>(position - distance);
+            for (auto *i = data, *end = data + size; i != end;) {
+                const auto bytesWritten = ::pwrite(nativeFileStream->fileDescriptor(), i, static_cast<std::size_t>(end - i), offset);
+                if (bytesWritten < 0) {
+                    if (errno == EINTR) {
+                        continue;
+                    }
+                    throw std::ios_base::failure("pwrite failed", std::error_code(errno, std::system_category()));
+                }
+                i += bytesWritten;
+                offset += bytesWritten;
+            }
+            return;
+        }
+    }
+#endif
+
+    // seek back to the field and forth again as a last resort
+    const auto position = m_stream->tellp();
+    m_stream->seekp(position - distance);
+    m_stream->write(data, size);
+    m_stream->seekp(position);
+}
+
+/*!
+ * \brief Writes the data pending in the write buffer to the assigned stream.
+ * \remarks The write buffer is considered empty afterwards, even if writing to the stream fails.
+ */
+void BinaryWriter::drainWriteBuffer()
+{
+    const auto size = m_writeBufferUsed;
+    m_writeBufferUsed = 0;
+    m_drainedBytes += size;
+    m_stream->write(m_writeBuffer.get(), static_cast<std::streamsize>(size));
 }
 
 } // namespace CppUtilities
@@ -2,17 +2,36 @@
 #define IOUTILITIES_BINARYWRITER_H
 
 #include "../conversion/binaryconversion.h"
+#include "./record.h"
 
+#include <algorithm>
 #include <cstdint>
 #include <cstring>
+#include <initializer_list>
+#include <memory>
 #include <ostream>
 #include <string>
+#include <string_view>
 #include <vector>
 
 namespace CppUtilities {
 
 class CPP_UTILITIES_EXPORT BinaryWriter {
 public:
+    /*!
+     * \brief The Placeholder struct refers to a field reserved via e.g. reserveUIntBE() to be resolved later via resolvePlaceholder().
+     */
+    struct Placeholder {
+        enum class Encoding : std::uint8_t {
+            BigEndian, /**< unsigned integer stored in big endian byte order */
+            LittleEndian, /**< unsigned integer stored in little endian byte order */
+            VariableLengthBigEndian, /**< unsigned integer stored like writeVariableLengthUIntBE() does but always using size bytes (e.g. EBML) */
+        };
+        std::uint64_t offset = 0; /**< the offset of the field in terms of writtenBytes() */
+        std::uint8_t size = 0; /**< the number of bytes reserved */
+        Encoding encoding = Encoding::BigEndian; /**< the encoding of the value */
+    };
+
     BinaryWriter(std::ostream *stream, bool giveOwnership = false);
     BinaryWriter(const BinaryWriter &other);
     BinaryWriter &operator=(const BinaryWriter &rhs) = delete;
@@ -25,6 +44,11 @@ public:
     void giveOwnership();
     void detatchOwnership();
     void flush();
+    void flushWriteBuffer();
+    std::size_t writeBufferSize() const;
+    void setWriteBufferSize(std::size_t bufferSize);
+    std::size_t bufferedBytes() const;
+    std::uint64_t writtenBytes() const;
     bool fail() const;
     void write(const char *buffer, std::streamsize length);
     void write(const std::vector<char> &buffer, std::streamsize length);
@@ -43,6 +67,7 @@ public:
     void writeInt64BE(std::int64_t value);
     void writeUInt64BE(std::uint64_t value);
     void writeVariableLengthUIntBE(std::uint64_t value);
+    void writeFloat16BE(float value);
     void writeFloat32BE(float value);
     void writeFloat64BE(double value);
     void writeInt16LE(std::int16_t value);
@@ -58,8 +83,41 @@ public:
     void writeInt64LE(std::int64_t value);
     void writeUInt64LE(std::uint64_t value);
     void writeVariableLengthUIntLE(std::uint64_t value);
+    void writeVarUInt64(std::uint64_t value);
+    void writeVarInt64(std::int64_t value);
+    void writeFloat16LE(float value);
     void writeFloat32LE(float value);
     void writeFloat64LE(double value);
+    void writeInt16BE(const std::int16_t *values, std::size_t count);
+    void writeUInt16BE(const std::uint16_t *values, std::size_t count);
+    void writeInt32BE(const std::int32_t *values, std::size_t count);
+    void writeUInt32BE(const std::uint32_t *values, std::size_t count);
+    void writeInt64BE(const std::int64_t *values, std::size_t count);
+    void writeUInt64BE(const std::uint64_t *values, std::size_t count);
+    void writeFloat32BE(const float *values, std::size_t count);
+    void writeFloat64BE(const double *values, std::size_t count);
+    void writeInt16LE(const std::int16_t *values, std::size_t count);
+    void writeUInt16LE(const std::uint16_t *values, std::size_t count);
+    void writeInt32LE(const std::int32_t *values, std::size_t count);
+    void writeUInt32LE(const std::uint32_t *values, std::size_t count);
+    void writeInt64LE(const std::int64_t *values, std::size_t count);
+    void writeUInt64LE(const std::uint64_t *values, std::size_t count);
+    void writeFloat32LE(const float *values, std::size_t count);
+    void writeFloat64LE(const double *values, std::size_t count);
+    void writeInt24BE(const std::int32_t *values, std::size_t count);
+    void writeInt24BE(const float *values, std::size_t count);
+    void writeInt24LE(const std::int32_t *values, std::size_t count);
+    void writeInt24LE(const float *values, std::size_t count);
+    void writeFloat16BE(const float *values, std::size_t count);
+    void writeFloat16LE(const float *values, std::size_t count);
+    template <typename Record> void writeRecord(const Record &record);
+    template <typename Record> void writeRecords(const Record *records, std::size_t count);
+    void writeGather(const std::string_view *pieces, std::size_t count);
+    void writeGather(std::initializer_list<std::string_view> pieces);
+    Placeholder reserveUIntBE(std::uint8_t size);
+    Placeholder reserveUIntLE(std::uint8_t size);
+    Placeholder reserveVariableLengthUIntBE(std::uint8_t size = 8);
+    void resolvePlaceholder(const Placeholder &placeholder, std::uint64_t value);
     void writeString(const std::string &value);
     void writeTerminatedString(const std::string &value);
     void writeLengthPrefixedString(const std::string &value);
@@ -90,10 +148,20 @@ public:
 
 private:
     void writeVariableLengthInteger(std::uint64_t size, void (*getBytes)(std::uint64_t, char *));
+    void writeData(const char *data, std::size_t size);
+    void writeDataUnbuffered(const char *data, std::size_t size);
+    void drainWriteBuffer();
+    Placeholder reservePlaceholder(std::uint8_t size, Placeholder::Encoding encoding);
+    template <bool isBigEndian, typename ValueType> void writeValues(const ValueType *values, std::size_t count);
+    template <bool isBigEndian, typename ValueType> void writeInt24Values(const ValueType *values, std::size_t count);
 
     std::ostream *m_stream;
     bool m_ownership;
     char m_buffer[8];
+    std::unique_ptr<char[]> m_writeBuffer;
+    std::size_t m_writeBufferSize;
+    std::size_t m_writeBufferUsed;
+    std::uint64_t m_drainedBytes;
 };
 
 /*!
@@ -104,24 +172,44 @@ private:
 inline BinaryWriter::BinaryWriter(std::ostream *stream, bool giveOwnership)
     : m_stream(stream)
     , m_ownership(giveOwnership)
+    , m_writeBufferSize(0)
+    , m_writeBufferUsed(0)
+    , m_drainedBytes(0)
 {
 }
 
 /*!
  * \brief Copies the specified BinaryWriter.
- * \remarks The copy will not take ownership over the stream.
+ * \remarks
+ * - The copy will not take ownership over the stream.
+ * - The copy will not use a write buffer (regardless of whether \a other uses one) so writes of the copy end up in the stream
+ *   immediately.
+ * - Data pending in the write buffer of \a other is not written by the copy. Call flushWriteBuffer() on \a other before
+ *   copying it (and before writing via \a other again after writing via the copy) if both are used to write to the stream;
+ *   otherwise the order of the written data is not defined.
  */
 inline BinaryWriter::BinaryWriter(const BinaryWriter &other)
     : m_stream(other.m_stream)
     , m_ownership(false)
+    , m_writeBufferSize(0)
+    , m_writeBufferUsed(0)
+    , m_drainedBytes(0)
 {
 }
 
 /*!
  * \brief Destroys the BinaryWriter.
+ * \remarks Data still pending in the write buffer is written to the stream before. Errors occurring when doing so
+ *          are swallowed; use flushWriteBuffer() before destroying the writer to get notified about them.
  */
 inline BinaryWriter::~BinaryWriter()
 {
+    if (m_writeBufferUsed) {
+        try {
+            drainWriteBuffer();
+        } catch (...) {
+        }
+    }
     if (m_ownership) {
         delete m_stream;
     }
@@ -186,13 +274,57 @@ inline void BinaryWriter::detatchOwnership()
 }
 
 /*!
- * \brief Calls the flush() method of the assigned stream.
+ * \brief Writes data pending in the write buffer to the assigned stream and calls the flush() method of the assigned stream.
  */
 inline void BinaryWriter::flush()
 {
+    flushWriteBuffer();
     m_stream->flush();
 }
 
+/*!
+ * \brief Writes data pending in the write buffer to the assigned stream.
+ * \remarks
+ * - Unlike flush() this does not call the flush() method of the assigned stream.
+ * - This must be called before accessing the assigned stream directly when a write buffer is used.
+ * \sa setWriteBufferSize()
+ */
+inline void BinaryWriter::flushWriteBuffer()
+{
+    if (m_writeBufferUsed) {
+        drainWriteBuffer();
+    }
+}
+
+/*!
+ * \brief Returns the size of the write buffer or zero if no write buffer is used (the default).
+ * \sa setWriteBufferSize()
+ */
+inline std::size_t BinaryWriter::writeBufferSize() const
+{
+    return m_writeBufferSize;
+}
+
+/*!
+ * \brief Returns the number of bytes pending in the write buffer.
+ * \sa setWriteBufferSize()
+ */
+inline std::size_t BinaryWriter::bufferedBytes() const
+{
+    return m_writeBufferUsed;
+}
+
+/*!
+ * \brief Returns the number of bytes written via the writer since the current stream has been assigned.
+ * \remarks This includes bytes pending in the write buffer. It is the reference for Placeholder::offset and can be used to
+ *          compute the size of an element without determining the position of the stream, e.g.
+ *          `writer.writtenBytes() - placeholder.offset - placeholder.size`.
+ */
+inline std::uint64_t BinaryWriter::writtenBytes() const
+{
+    return m_drainedBytes + m_writeBufferUsed;
+}
+
 /*!
  * \brief Returns an indication whether the fail bit of the assigned stream is set.
  */
@@ -201,12 +333,28 @@ inline bool BinaryWriter::fail() const
     return m_stream ? m_stream->fail() : false;
 }
 
+/*!
+ * \brief Writes the specified \a data to the write buffer or directly to the assigned stream if no write buffer is used.
+ * \remarks This is the common code path of all write-methods and must be kept small to be inlined.
+ */
+inline void BinaryWriter::writeData(const char *data, std::size_t size)
+{
+    if (m_writeBufferSize && size <= m_writeBufferSize - m_writeBufferUsed) {
+        std::memcpy(m_writeBuffer.get() + m_writeBufferUsed, data, size);
+        m_writeBufferUsed += size;
+    } else {
+        writeDataUnbuffered(data, size);
+    }
+}
+
 /*!
  * \brief Writes a character array to the current stream and advances the current position of the stream by the \a length of the array.
+ * \remarks If a write buffer is used and the array does not fit into it, pending data is written and the array is written
+ *          directly (bypassing the write buffer) if it is at least as big as the write buffer.
  */
 inline void BinaryWriter::write(const char *buffer, std::streamsize length)
 {
-    m_stream->write(buffer, length);
+    writeData(buffer, static_cast<std::size_t>(length));
 }
 
 /*!
@@ -215,7 +363,7 @@ inline void BinaryWriter::write(const char *buffer, std::streamsize length)
  */
 inline void BinaryWriter::write(const std::vector<char> &buffer, std::streamsize length)
 {
-    m_stream->write(buffer.data(), length);
+    writeData(buffer.data(), static_cast<std::size_t>(length));
 }
 
 /*!
@@ -224,7 +372,7 @@ inline void BinaryWriter::write(const std::vector<char> &buffer, std::streamsize
 inline void BinaryWriter::writeChar(char value)
 {
     m_buffer[0] = value;
-    m_stream->write(m_buffer, 1);
+    writeData(m_buffer, 1);
 }
 
 /*!
@@ -233,7 +381,7 @@ inline void BinaryWriter::writeChar(char value)
 inline void BinaryWriter::writeByte(std::uint8_t value)
 {
     m_buffer[0] = *reinterpret_cast<char *>(&value);
-    m_stream->write(m_buffer, 1);
+    writeData(m_buffer, 1);
 }
 
 /*!
@@ -250,7 +398,7 @@ inline void BinaryWriter::writeBool(bool value)
 inline void BinaryWriter::writeInt16BE(std::int16_t value)
 {
     BE::getBytes(value, m_buffer);
-    m_stream->write(m_buffer, sizeof(std::int16_t));
+    writeData(m_buffer, sizeof(std::int16_t));
 }
 
 /*!
@@ -259,7 +407,7 @@ inline void BinaryWriter::writeInt16BE(std::int16_t value)
 inline void BinaryWriter::writeUInt16BE(std::uint16_t value)
 {
     BE::getBytes(value, m_buffer);
-    m_stream->write(m_buffer, sizeof(std::uint16_t));
+    writeData(m_buffer, sizeof(std::uint16_t));
 }
 
 /*!
@@ -269,7 +417,7 @@ inline void BinaryWriter::writeUInt16BE(std::uint16_t value)
 inline void BinaryWriter::writeInt24BE(std::int32_t value)
 {
     BE::getBytes(value, m_buffer);
-    m_stream->write(m_buffer + 1, 3);
+    writeData(m_buffer + 1, 3);
 }
 
 /*!
@@ -280,7 +428,7 @@ inline void BinaryWriter::writeUInt24BE(std::uint32_t value)
 {
     // discard most significant byte
     BE::getBytes(value, m_buffer);
-    m_stream->write(m_buffer + 1, 3);
+    writeData(m_buffer + 1, 3);
 }
 
 /*!
@@ -289,7 +437,7 @@ inline void BinaryWriter::writeUInt24BE(std::uint32_t value)
 inline void BinaryWriter::writeInt32BE(std::int32_t value)
 {
     BE::getBytes(value, m_buffer);
-    m_stream->write(m_buffer, sizeof(std::int32_t));
+    writeData(m_buffer, sizeof(std::int32_t));
 }
 
 /*!
@@ -298,7 +446,7 @@ inline void BinaryWriter::writeInt32BE(std::int32_t value)
 inline void BinaryWriter::writeUInt32BE(std::uint32_t value)
 {
     BE::getBytes(value, m_buffer);
-    m_stream->write(m_buffer, sizeof(std::uint32_t));
+    writeData(m_buffer, sizeof(std::uint32_t));
 }
 
 /*!
@@ -308,7 +456,7 @@ inline void BinaryWriter::writeUInt32BE(std::uint32_t value)
 inline void BinaryWriter::writeInt40BE(std::int64_t value)
 {
     BE::getBytes(value, m_buffer);
-    m_stream->write(m_buffer + 3, 5);
+    writeData(m_buffer + 3, 5);
 }
 
 /*!
@@ -318,7 +466,7 @@ inline void BinaryWriter::writeInt40BE(std::int64_t value)
 inline void BinaryWriter::writeUInt40BE(std::uint64_t value)
 {
     BE::getBytes(value, m_buffer);
-    m_stream->write(m_buffer + 3, 5);
+    writeData(m_buffer + 3, 5);
 }
 
 /*!
@@ -328,7 +476,7 @@ inline void BinaryWriter::writeUInt40BE(std::uint64_t value)
 inline void BinaryWriter::writeInt56BE(std::int64_t value)
 {
     BE::getBytes(value, m_buffer);
-    m_stream->write(m_buffer + 1, 7);
+    writeData(m_buffer + 1, 7);
 }
 
 /*!
@@ -338,7 +486,7 @@ inline void BinaryWriter::writeInt56BE(std::int64_t value)
 inline void BinaryWriter::writeUInt56BE(std::uint64_t value)
 {
     BE::getBytes(value, m_buffer);
-    m_stream->write(m_buffer + 1, 7);
+    writeData(m_buffer + 1, 7);
 }
 
 /*!
@@ -347,7 +495,7 @@ inline void BinaryWriter::writeUInt56BE(std::uint64_t value)
 inline void BinaryWriter::writeInt64BE(std::int64_t value)
 {
     BE::getBytes(value, m_buffer);
-    m_stream->write(m_buffer, sizeof(std::int64_t));
+    writeData(m_buffer, sizeof(std::int64_t));
 }
 
 /*!
@@ -356,7 +504,7 @@ inline void BinaryWriter::writeInt64BE(std::int64_t value)
 inline void BinaryWriter::writeUInt64BE(std::uint64_t value)
 {
     BE::getBytes(value, m_buffer);
-    m_stream->write(m_buffer, sizeof(std::uint64_t));
+    writeData(m_buffer, sizeof(std::uint64_t));
 }
 
 /*!
@@ -368,13 +516,24 @@ inline void BinaryWriter::writeVariableLengthUIntBE(std::uint64_t value)
     writeVariableLengthInteger(value, static_cast<void (*)(std::uint64_t, char *)>(&BE::getBytes));
 }
 
+/*!
+ * \brief Writes a 16-bit big endian floating point \a value (IEEE-754 binary16) to the current stream and advances the current position
+ *        of the stream by two bytes.
+ * \remarks The \a value is rounded to nearest (even); see toFloat16() for details.
+ */
+inline void BinaryWriter::writeFloat16BE(float value)
+{
+    BE::getFloat16Bytes(value, m_buffer);
+    writeData(m_buffer, 2);
+}
+
 /*!
  * \brief Writes a 32-bit big endian floating point \a value to the current stream and advances the current position of the stream by four bytes.
  */
 inline void BinaryWriter::writeFloat32BE(float value)
 {
     BE::getBytes(value, m_buffer);
-    m_stream->write(m_buffer, sizeof(float));
+    writeData(m_buffer, sizeof(float));
 }
 
 /*!
@@ -383,7 +542,7 @@ inline void BinaryWriter::writeFloat32BE(float value)
 inline void BinaryWriter::writeFloat64BE(double value)
 {
     BE::getBytes(value, m_buffer);
-    m_stream->write(m_buffer, sizeof(double));
+    writeData(m_buffer, sizeof(double));
 }
 
 /*!
@@ -392,7 +551,7 @@ inline void BinaryWriter::writeFloat64BE(double value)
 inline void BinaryWriter::writeInt16LE(std::int16_t value)
 {
     LE::getBytes(value, m_buffer);
-    m_stream->write(m_buffer, sizeof(std::int16_t));
+    writeData(m_buffer, sizeof(std::int16_t));
 }
 
 /*!
@@ -401,7 +560,7 @@ inline void BinaryWriter::writeInt16LE(std::int16_t value)
 inline void BinaryWriter::writeUInt16LE(std::uint16_t value)
 {
     LE::getBytes(value, m_buffer);
-    m_stream->write(m_buffer, sizeof(std::uint16_t));
+    writeData(m_buffer, sizeof(std::uint16_t));
 }
 
 /*!
@@ -412,7 +571,7 @@ inline void BinaryWriter::writeInt24LE(std::int32_t value)
 {
     // discard most significant byte
     LE::getBytes(value, m_buffer);
-    m_stream->write(m_buffer, 3);
+    writeData(m_buffer, 3);
 }
 
 /*!
@@ -423,7 +582,7 @@ inline void BinaryWriter::writeUInt24LE(std::uint32_t value)
 {
     // discard most significant byte
     LE::getBytes(value, m_buffer);
-    m_stream->write(m_buffer, 3);
+    writeData(m_buffer, 3);
 }
 
 /*!
@@ -432,7 +591,7 @@ inline void BinaryWriter::writeUInt24LE(std::uint32_t value)
 inline void BinaryWriter::writeInt32LE(std::int32_t value)
 {
     LE::getBytes(value, m_buffer);
-    m_stream->write(m_buffer, sizeof(std::int32_t));
+    writeData(m_buffer, sizeof(std::int32_t));
 }
 
 /*!
@@ -441,7 +600,7 @@ inline void BinaryWriter::writeInt32LE(std::int32_t value)
 inline void BinaryWriter::writeUInt32LE(std::uint32_t value)
 {
     LE::getBytes(value, m_buffer);
-    m_stream->write(m_buffer, sizeof(std::uint32_t));
+    writeData(m_buffer, sizeof(std::uint32_t));
 }
 
 /*!
@@ -451,7 +610,7 @@ inline void BinaryWriter::writeUInt32LE(std::uint32_t value)
 inline void BinaryWriter::writeInt40LE(std::int64_t value)
 {
     LE::getBytes(value, m_buffer);
-    m_stream->write(m_buffer, 5);
+    writeData(m_buffer, 5);
 }
 
 /*!
@@ -461,7 +620,7 @@ inline void BinaryWriter::writeInt40LE(std::int64_t value)
 inline void BinaryWriter::writeUInt40LE(std::uint64_t value)
 {
     LE::getBytes(value, m_buffer);
-    m_stream->write(m_buffer, 5);
+    writeData(m_buffer, 5);
 }
 
 /*!
@@ -471,7 +630,7 @@ inline void BinaryWriter::writeUInt40LE(std::uint64_t value)
 inline void BinaryWriter::writeInt56LE(std::int64_t value)
 {
     LE::getBytes(value, m_buffer);
-    m_stream->write(m_buffer, 7);
+    writeData(m_buffer, 7);
 }
 
 /*!
@@ -481,7 +640,7 @@ inline void BinaryWriter::writeInt56LE(std::int64_t value)
 inline void BinaryWriter::writeUInt56LE(std::uint64_t value)
 {
     LE::getBytes(value, m_buffer);
-    m_stream->write(m_buffer, 7);
+    writeData(m_buffer, 7);
 }
 
 /*!
@@ -490,7 +649,7 @@ inline void BinaryWriter::writeUInt56LE(std::uint64_t value)
 inline void BinaryWriter::writeInt64LE(std::int64_t value)
 {
     LE::getBytes(value, m_buffer);
-    m_stream->write(m_buffer, sizeof(std::int64_t));
+    writeData(m_buffer, sizeof(std::int64_t));
 }
 
 /*!
@@ -499,7 +658,7 @@ inline void BinaryWriter::writeInt64LE(std::int64_t value)
 inline void BinaryWriter::writeUInt64LE(std::uint64_t value)
 {
     LE::getBytes(value, m_buffer);
-    m_stream->write(m_buffer, sizeof(std::uint64_t));
+    writeData(m_buffer, sizeof(std::uint64_t));
 }
 
 /*!
@@ -511,13 +670,43 @@ inline void BinaryWriter::writeVariableLengthUIntLE(std::uint64_t value)
     writeVariableLengthInteger(value, static_cast<void (*)(std::uint64_t, char *)>(&LE::getBytes));
 }
 
+/*!
+ * \brief Writes the specified unsigned integer LEB128 encoded to the current stream and advances the current position of the stream by one to ten bytes.
+ * \sa toVarUInt64()
+ */
+inline void BinaryWriter::writeVarUInt64(std::uint64_t value)
+{
+    char bytes[10];
+    writeData(bytes, toVarUInt64(value, bytes));
+}
+
+/*!
+ * \brief Writes the specified signed integer ZigZag and LEB128 encoded to the current stream and advances the current position of the stream by one to ten bytes.
+ * \sa toZigZagInt(), toVarUInt64()
+ */
+inline void BinaryWriter::writeVarInt64(std::int64_t value)
+{
+    writeVarUInt64(toZigZagInt(value));
+}
+
+/*!
+ * \brief Writes a 16-bit little endian floating point \a value (IEEE-754 binary16) to the current stream and advances the current position
+ *        of the stream by two bytes.
+ * \remarks The \a value is rounded to nearest (even); see toFloat16() for details.
+ */
+inline void BinaryWriter::writeFloat16LE(float value)
+{
+    LE::getFloat16Bytes(value, m_buffer);
+    writeData(m_buffer, 2);
+}
+
 /*!
  * \brief Writes a 32-bit little endian floating point \a value to the current stream and advances the current position of the stream by four bytes.
  */
 inline void BinaryWriter::writeFloat32LE(float value)
 {
     LE::getBytes(value, m_buffer);
-    m_stream->write(m_buffer, sizeof(float));
+    writeData(m_buffer, sizeof(float));
 }
 
 /*!
@@ -526,7 +715,263 @@ inline void BinaryWriter::writeFloat32LE(float value)
 inline void BinaryWriter::writeFloat64LE(double value)
 {
     LE::getBytes(value, m_buffer);
-    m_stream->write(m_buffer, sizeof(double));
+    writeData(m_buffer, sizeof(double));
+}
+
+/*!
+ * \brief Writes \a count values of the specified \a ValueType from \a values using the specified byte order.
+ * \remarks If the byte order needs to be converted, the values are converted in chunks on the stack using swapOrder() for
+ *          arrays; otherwise all values are written with one call of std::ostream::write().
+ */
+template <bool isBigEndian, typename ValueType> inline void BinaryWriter::writeValues(const ValueType *values, std::size_t count)
+{
+    if constexpr (isBigEndian == CONVERSION_UTILITIES_IS_BYTE_ORDER_BIG_ENDIAN) {
+        writeData(reinterpret_cast<const char *>(values), count * sizeof(ValueType));
+    } else {
+        constexpr std::size_t chunkSize = 4096 / sizeof(ValueType);
+        ValueType chunk[chunkSize];
+        for (std::size_t chunkCount; count; count -= chunkCount, values += chunkCount) {
+            chunkCount = std::min(count, chunkSize);
+            std::memcpy(chunk, values, chunkCount * sizeof(ValueType));
+            swapOrder(chunk, chunkCount);
+            writeData(reinterpret_cast<const char *>(chunk), chunkCount * sizeof(ValueType));
+        }
+    }
+}
+
+/*!
+ * \brief Writes \a count 16-bit big endian signed integers from \a values to the current stream and advances the current position
+ *        of the stream by \a count times the size of a single value.
+ */
+inline void BinaryWriter::writeInt16BE(const std::int16_t *values, std::size_t count)
+{
+    writeValues<true>(values, count);
+}
+
+/*!
+ * \brief Writes \a count 16-bit big endian unsigned integers from \a values to the current stream and advances the current position
+ *        of the stream by \a count times the size of a single value.
+ */
+inline void BinaryWriter::writeUInt16BE(const std::uint16_t *values, std::size_t count)
+{
+    writeValues<true>(values, count);
+}
+
+/*!
+ * \brief Writes \a count 32-bit big endian signed integers from \a values to the current stream and advances the current position
+ *        of the stream by \a count times the size of a single value.
+ */
+inline void BinaryWriter::writeInt32BE(const std::int32_t *values, std::size_t count)
+{
+    writeValues<true>(values, count);
+}
+
+/*!
+ * \brief Writes \a count 32-bit big endian unsigned integers from \a values to the current stream and advances the current position
+ *        of the stream by \a count times the size of a single value.
+ */
+inline void BinaryWriter::writeUInt32BE(const std::uint32_t *values, std::size_t count)
+{
+    writeValues<true>(values, count);
+}
+
+/*!
+ * \brief Writes \a count 64-bit big endian signed integers from \a values to the current stream and advances the current position
+ *        of the stream by \a count times the size of a single value.
+ */
+inline void BinaryWriter::writeInt64BE(const std::int64_t *values, std::size_t count)
+{
+    writeValues<true>(values, count);
+}
+
+/*!
+ * \brief Writes \a count 64-bit big endian unsigned integers from \a values to the current stream and advances the current position
+ *        of the stream by \a count times the size of a single value.
+ */
+inline void BinaryWriter::writeUInt64BE(const std::uint64_t *values, std::size_t count)
+{
+    writeValues<true>(values, count);
+}
+
+/*!
+ * \brief Writes \a count 32-bit big endian floating point values from \a values to the current stream and advances the current position
+ *        of the stream by \a count times the size of a single value.
+ */
+inline void BinaryWriter::writeFloat32BE(const float *values, std::size_t count)
+{
+    writeValues<true>(values, count);
+}
+
+/*!
+ * \brief Writes \a count 64-bit big endian floating point values from \a values to the current stream and advances the current position
+ *        of the stream by \a count times the size of a single value.
+ */
+inline void BinaryWriter::writeFloat64BE(const double *values, std::size_t count)
+{
+    writeValues<true>(values, count);
+}
+
+/*!
+ * \brief Writes \a count 16-bit little endian signed integers from \a values to the current stream and advances the current position
+ *        of the stream by \a count times the size of a single value.
+ */
+inline void BinaryWriter::writeInt16LE(const std::int16_t *values, std::size_t count)
+{
+    writeValues<false>(values, count);
+}
+
+/*!
+ * \brief Writes \a count 16-bit little endian unsigned integers from \a values to the current stream and advances the current position
+ *        of the stream by \a count times the size of a single value.
+ */
+inline void BinaryWriter::writeUInt16LE(const std::uint16_t *values, std::size_t count)
+{
+    writeValues<false>(values, count);
+}
+
+/*!
+ * \brief Writes \a count 32-bit little endian signed integers from \a values to the current stream and advances the current position
+ *        of the stream by \a count times the size of a single value.
+ */
+inline void BinaryWriter::writeInt32LE(const std::int32_t *values, std::size_t count)
+{
+    writeValues<false>(values, count);
+}
+
+/*!
+ * \brief Writes \a count 32-bit little endian unsigned integers from \a values to the current stream and advances the current position
+ *        of the stream by \a count times the size of a single value.
+ */
+inline void BinaryWriter::writeUInt32LE(const std::uint32_t *values, std::size_t count)
+{
+    writeValues<false>(values, count);
+}
+
+/*!
+ * \brief Writes \a count 64-bit little endian signed integers from \a values to the current stream and advances the current position
+ *        of the stream by \a count times the size of a single value.
+ */
+inline void BinaryWriter::writeInt64LE(const std::int64_t *values, std::size_t count)
+{
+    writeValues<false>(values, count);
+}
+
+/*!
+ * \brief Writes \a count 64-bit little endian unsigned integers from \a values to the current stream and advances the current position
+ *        of the stream by \a count times the size of a single value.
+ */
+inline void BinaryWriter::writeUInt64LE(const std::uint64_t *values, std::size_t count)
+{
+    writeValues<false>(values, count);
+}
+
+/*!
+ * \brief Writes \a count 32-bit little endian floating point values from \a values to the current stream and advances the current position
+ *        of the stream by \a count times the size of a single value.
+ */
+inline void BinaryWriter::writeFloat32LE(const float *values, std::size_t count)
+{
+    writeValues<false>(values, count);
+}
+
+/*!
+ * \brief Writes \a count 64-bit little endian floating point values from \a values to the current stream and advances the current position
+ *        of the stream by \a count times the size of a single value.
+ */
+inline void BinaryWriter::writeFloat64LE(const double *values, std::size_t count)
+{
+    writeValues<false>(values, count);
+}
+
+/*!
+ * \brief Writes \a count values from \a values as packed 24-bit values with the specified byte order.
+ * \remarks Converts the values in chunks of about 4 KiB on the stack via BE::getBytes24() or LE::getBytes24().
+ */
+template <bool isBigEndian, typename ValueType> inline void BinaryWriter::writeInt24Values(const ValueType *values, std::size_t count)
+{
+    constexpr std::size_t chunkSize = 4095 / 3;
+    char chunk[chunkSize * 3];
+    for (std::size_t chunkCount; count; count -= chunkCount, values += chunkCount) {
+        chunkCount = std::min(count, chunkSize);
+        if constexpr (isBigEndian) {
+            BE::getBytes24(values, chunkCount, chunk);
+        } else {
+            LE::getBytes24(values, chunkCount, chunk);
+        }
+        writeData(chunk, chunkCount * 3);
+    }
+}
+
+/*!
+ * \brief Writes \a count integers from \a values as packed 24-bit big endian integers (e.g. PCM samples) to the current stream and
+ *        advances the current position of the stream by \a count times three bytes.
+ * \remarks The most significant byte of each value is discarded.
+ */
+inline void BinaryWriter::writeInt24BE(const std::int32_t *values, std::size_t count)
+{
+    writeInt24Values<true>(values, count);
+}
+
+/*!
+ * \brief Writes \a count normalized samples from \a values as packed 24-bit big endian integers to the current stream and
+ *        advances the current position of the stream by \a count times three bytes.
+ * \remarks Values outside of [-1, 1) are clamped.
+ */
+inline void BinaryWriter::writeInt24BE(const float *values, std::size_t count)
+{
+    writeInt24Values<true>(values, count);
+}
+
+/*!
+ * \brief Writes \a count integers from \a values as packed 24-bit little endian integers (e.g. PCM samples) to the current stream
+ *        and advances the current position of the stream by \a count times three bytes.
+ * \remarks The most significant byte of each value is discarded.
+ */
+inline void BinaryWriter::writeInt24LE(const std::int32_t *values, std::size_t count)
+{
+    writeInt24Values<false>(values, count);
+}
+
+/*!
+ * \brief Writes \a count normalized samples from \a values as packed 24-bit little endian integers to the current stream and
+ *        advances the current position of the stream by \a count times three bytes.
+ * \remarks Values outside of [-1, 1) are clamped.
+ */
+inline void BinaryWriter::writeInt24LE(const float *values, std::size_t count)
+{
+    writeInt24Values<false>(values, count);
+}
+
+/*!
+ * \brief Writes \a count values from \a values as 16-bit big endian floating point values (IEEE-754 binary16) to the current stream and
+ *        advances the current position of the stream by \a count times two bytes.
+ * \remarks Converts the values in chunks of 4 KiB on the stack via BE::getFloat16Bytes().
+ */
+inline void BinaryWriter::writeFloat16BE(const float *values, std::size_t count)
+{
+    constexpr std::size_t chunkSize = 2048;
+    char chunk[chunkSize * 2];
+    for (std::size_t chunkCount; count; count -= chunkCount, values += chunkCount) {
+        chunkCount = std::min(count, chunkSize);
+        BE::getFloat16Bytes(values, chunkCount, chunk);
+        writeData(chunk, chunkCount * 2);
+    }
+}
+
+/*!
+ * \brief Writes \a count values from \a values as 16-bit little endian floating point values (IEEE-754 binary16) to the current stream
+ *        and advances the current position of the stream by \a count times two bytes.
+ * \remarks Converts the values in chunks of 4 KiB on the stack via LE::getFloat16Bytes().
+ */
+inline void BinaryWriter::writeFloat16LE(const float *values, std::size_t count)
+{
+    constexpr std::size_t chunkSize = 2048;
+    char chunk[chunkSize * 2];
+    for (std::size_t chunkCount; count; count -= chunkCount, values += chunkCount) {
+        chunkCount = std::min(count, chunkSize);
+        LE::getFloat16Bytes(values, chunkCount, chunk);
+        writeData(chunk, chunkCount * 2);
+    }
 }
 
 /*!
@@ -534,7 +979,7 @@ inline void BinaryWriter::writeFloat64LE(double value)
  */
 inline void BinaryWriter::writeString(const std::string &value)
 {
-    m_stream->write(value.data(), static_cast<std::streamsize>(value.size()));
+    writeData(value.data(), value.size());
 }
 
 /*!
@@ -542,7 +987,7 @@ inline void BinaryWriter::writeString(const std::string &value)
  */
 inline void BinaryWriter::writeTerminatedString(const std::string &value)
 {
-    m_stream->write(value.data(), static_cast<std::streamsize>(value.size() + 1));
+    writeData(value.data(), value.size() + 1);
 }
 
 /*!
@@ -555,7 +1000,7 @@ inline void BinaryWriter::writeTerminatedString(const std::string &value)
 inline void BinaryWriter::writeLengthPrefixedString(const std::string &value)
 {
     writeVariableLengthUIntBE(value.size());
-    m_stream->write(value.data(), static_cast<std::streamsize>(value.size()));
+    writeData(value.data(), value.size());
 }
 
 /*!
@@ -568,7 +1013,7 @@ inline void BinaryWriter::writeLengthPrefixedString(const std::string &value)
 inline void BinaryWriter::writeLengthPrefixedCString(const char *value, std::size_t size)
 {
     writeVariableLengthUIntBE(size);
-    m_stream->write(value, static_cast<std::streamsize>(size));
+    writeData(value, size);
 }
 
 /*!
@@ -740,6 +1185,77 @@ inline void BinaryWriter::write(double one64BitFloat)
 {
     writeFloat64BE(one64BitFloat);
 }
+
+/*!
+ * \brief Writes the specified \a record to the current stream and advances the current position of the stream by the size of
+ *        the record.
+ * \remarks The record is encoded according to its RecordSchema and written with one call of std::ostream::write() (or
+ *          copied to the write buffer as a whole).
+ */
+template <typename Record> inline void BinaryWriter::writeRecord(const Record &record)
+{
+    char buffer[recordSize<Record>];
+    encodeRecord(record, buffer);
+    writeData(buffer, recordSize<Record>);
+}
+
+/*!
+ * \brief Writes \a count records from \a records to the current stream and advances the current position of the stream by
+ *        \a count times the size of a single record.
+ * \remarks The records are encoded in chunks of about 4 KiB on the stack and each chunk is written with one call of
+ *          std::ostream::write().
+ */
+template <typename Record> void BinaryWriter::writeRecords(const Record *records, std::size_t count)
+{
+    constexpr auto chunkSize = Detail::recordsPerChunk<Record>();
+    char chunk[chunkSize * recordSize<Record>];
+    for (std::size_t chunkCount; count; count -= chunkCount) {
+        chunkCount = std::min(count, chunkSize);
+        for (auto *i = chunk, *end = chunk + chunkCount * recordSize<Record>; i != end; i += recordSize<Record>) {
+            encodeRecord(*records++, i);
+        }
+        writeData(chunk, chunkCount * recordSize<Record>);
+    }
+}
+
+/*!
+ * \brief Writes the specified \a pieces one after another.
+ * \sa See the other overload for details.
+ */
+inline void BinaryWriter::writeGather(std::initializer_list<std::string_view> pieces)
+{
+    writeGather(pieces.begin(), pieces.size());
+}
+
+/*!
+ * \brief Reserves a big endian unsigned integer with \a size bytes (1 to 8) to be written later via resolvePlaceholder().
+ * \throws Throws ConversionException if \a size is not supported.
+ */
+inline BinaryWriter::Placeholder BinaryWriter::reserveUIntBE(std::uint8_t size)
+{
+    return reservePlaceholder(size, Placeholder::Encoding::BigEndian);
+}
+
+/*!
+ * \brief Reserves a little endian unsigned integer with \a size bytes (1 to 8) to be written later via resolvePlaceholder().
+ * \throws Throws ConversionException if \a size is not supported.
+ */
+inline BinaryWriter::Placeholder BinaryWriter::reserveUIntLE(std::uint8_t size)
+{
+    return reservePlaceholder(size, Placeholder::Encoding::LittleEndian);
+}
+
+/*!
+ * \brief Reserves a variable length unsigned integer (as written by writeVariableLengthUIntBE()) with \a size bytes (1 to 8)
+ *        to be written later via resolvePlaceholder().
+ * \remarks The integer will always occupy \a size bytes regardless of its value, e.g. as EBML allows for element sizes.
+ * \throws Throws ConversionException if \a size is not supported.
+ */
+inline BinaryWriter::Placeholder BinaryWriter::reserveVariableLengthUIntBE(std::uint8_t size)
+{
+    return reservePlaceholder(size, Placeholder::Encoding::VariableLengthBigEndian);
+}
+
 } // namespace CppUtilities
 
 #endif // IO_UTILITIES_BINARYWRITER_H
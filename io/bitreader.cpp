@@ -1,30 +1,156 @@
 #include "./bitreader.h"
 
+#include "../misc/cpufeaturesprivate.h"
+
 using namespace std;
 
 namespace CppUtilities {
 
+/// \cond
+namespace Detail {
+
+/*!
+ * \brief Returns the position of the first emulation prevention byte (the 0x03 of the sequence 0x00 0x00 0x03) within
+ *        \a begin and \a end or \a end if there is none.
+ */
+inline const std::uint8_t *findEmulationPreventionByteScalar(const std::uint8_t *begin, const std::uint8_t *end)
+{
+    if (end - begin < 3) {
+        return end;
+    }
+    for (auto *current = begin + 2; current < end;) {
+        if (!*current) {
+            ++current;
+        } else if (*current == 0x03 && !current[-1] && !current[-2]) {
+            return current;
+        } else {
+            // neither the current nor the next two bytes can be an emulation prevention byte
+            current += 3;
+        }
+    }
+    return end;
+}
+
+#ifdef CPP_UTILITIES_X86_DISPATCH
+CPP_UTILITIES_TARGET("sse2") const std::uint8_t *findEmulationPreventionByteSse2(const std::uint8_t *begin, const std::uint8_t *end)
+{
+    const auto zero = _mm_setzero_si128(), three = _mm_set1_epi8(0x03);
+    for (; end - begin >= 18; begin += 16) {
+        const auto first = _mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i *>(begin)), zero);
+        const auto second = _mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i *>(begin + 1)), zero);
+        const auto third = _mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i *>(begin + 2)), three);
+        if (const auto matches = static_cast<unsigned int>(_mm_movemask_epi8(_mm_and_si128(_mm_and_si128(first, second), third)))) {
+            return begin + __builtin_ctz(matches) + 2;
+        }
+    }
+    return findEmulationPreventionByteScalar(begin, end);
+}
+
+CPP_UTILITIES_TARGET("avx2") const std::uint8_t *findEmulationPreventionByteAvx2(const std::uint8_t *begin, const std::uint8_t *end)
+{
+    const auto zero = _mm256_setzero_si256(), three = _mm256_set1_epi8(0x03);
+    for (; end - begin >= 34; begin += 32) {
+        const auto first = _mm256_cmpeq_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(begin)), zero);
+        const auto second = _mm256_cmpeq_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(begin + 1)), zero);
+        const auto third = _mm256_cmpeq_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(begin + 2)), three);
+        if (const auto matches = static_cast<unsigned int>(_mm256_movemask_epi8(_mm256_and_si256(_mm256_and_si256(first, second), third)))) {
+            return begin + __builtin_ctz(matches) + 2;
+        }
+    }
+    return findEmulationPreventionByteSse2(begin, end);
+}
+#endif
+
+/*!
+ * \brief Returns the position of the first emulation prevention byte within \a begin and \a end or \a end if there is
+ *        none using the best kernel the CPU supports.
+ * \remarks The sequence 0x00 0x00 0x03 is compared at 16 or 32 positions at once if SSE2 or AVX2 is supported.
+ */
+const std::uint8_t *findEmulationPreventionByte(const std::uint8_t *begin, const std::uint8_t *end)
+{
+#ifdef CPP_UTILITIES_X86_DISPATCH
+    if (CpuFeatures::hasAvx2()) {
+        return findEmulationPreventionByteAvx2(begin, end);
+    }
+    if (CpuFeatures::hasSse2()) {
+        return findEmulationPreventionByteSse2(begin, end);
+    }
+#endif
+    return findEmulationPreventionByteScalar(begin, end);
+}
+
+} // namespace Detail
+/// \endcond
+
 /*!
  * \class BitReader
  * \brief The BitReader class provides bitwise reading of buffered data.
+ *
+ * Bits are read most significant bit first via a 64-bit cache which is refilled with a single unaligned big endian load
+ * (as long as at least 8 bytes are left) so reading, showing and skipping a number of bits usually only boils down to
+ * a few shifts. The cache is implemented by Detail::BasicBitReader which is shared with LsbBitReader.
+ *
+ * H.264/HEVC NAL units can be parsed in place by enabling setSkippingEmulationPreventionBytes(). Then the reader leaves
+ * out emulation prevention bytes while refilling its cache so unescaping the NAL unit into a copy is not required.
+ */
+
+/*!
+ * \brief Sets whether emulation prevention bytes are skipped.
+ *
+ * H.264 and HEVC insert an emulation prevention byte (0x03) into NAL units after two zero bytes to prevent start codes
+ * within the payload. If enabled, these bytes are skipped so the payload can be read without unescaping it first.
+ * The next emulation prevention byte is located in advance via a SIMD scan (if supported by the CPU) so the single load
+ * into the cache can still be used for bytes in front of it. The emulation prevention bytes are counted once here so
+ * bitsAvailable() does not need to scan the remaining buffer.
+ *
+ * \remarks
+ * - Must be set before reading from the buffer (or after reset()) because bytes already loaded into the cache are not
+ *   taken into account.
+ * - Escaping is expected to be applied within the whole buffer so the buffer should only contain the NAL unit payload
+ *   (without start code).
+ */
+void BitReader::setSkippingEmulationPreventionBytes(bool skipping)
+{
+    m_skippingEscapes = skipping;
+    locateEmulationPreventionBytes(m_buffer);
+}
+
+/*!
+ * \brief Locates the next emulation prevention byte and counts the remaining ones (if skipping them).
+ * \param begin Specifies where to start scanning. It may be up to two bytes in front of the current position of the buffer
+ *        so bytes which have already been consumed are taken into account for detecting the sequence 0x00 0x00 0x03.
  */
+void BitReader::locateEmulationPreventionBytes(const std::uint8_t *begin)
+{
+    m_nextEscape = m_skippingEscapes ? Detail::findEmulationPreventionByte(begin, m_end) : m_end;
+    m_remainingEscapes = 0;
+    for (auto *escape = m_nextEscape; escape != m_end; escape = Detail::findEmulationPreventionByte(escape + 1, m_end)) {
+        ++m_remainingEscapes;
+    }
+}
+
+/*!
+ * \brief Skips the emulation prevention byte the buffer is currently at and locates the next one.
+ */
+void BitReader::skipEmulationPreventionByte()
+{
+    m_nextEscape = Detail::findEmulationPreventionByte(++m_buffer, m_end);
+    --m_remainingEscapes;
+}
 
 /*!
- * \brief Skips the specified number of bits without reading it.
- * \param bitCount Specifies the number of bits to skip.
- * \throws Throws std::ios_base::failure if the end of the buffer is exceeded.
- *         The reader becomes invalid in that case.
+ * \brief Reads an "Exp-Golomb coded" code number which is not entirely within the cache.
+ * \remarks This is the slow path of readExpGolombCode() for long codes and codes at the end of the buffer.
  */
-void BitReader::skipBits(std::size_t bitCount)
+std::uint64_t BitReader::readLongExpGolombCode()
 {
-    if (bitCount <= m_bitsAvail) {
-        m_bitsAvail -= static_cast<std::uint8_t>(bitCount);
-    } else {
-        if ((m_buffer += 1 + (bitCount -= m_bitsAvail) / 8) >= m_end) {
-            throw ios_base::failure("end of buffer exceeded");
+    auto leadingZeros = std::uint8_t();
+    for (; !readBit(); ++leadingZeros) {
+        if (leadingZeros == 63) {
+            throw ios_base::failure("Exp-Golomb coded value exceeds 64 bits");
         }
-        m_bitsAvail = 8 - (bitCount % 8);
     }
+    return ((std::uint64_t(1) << leadingZeros) | readBits<std::uint64_t>(leadingZeros)) - 1;
 }
 
 } // namespace CppUtilities
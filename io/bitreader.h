@@ -1,7 +1,9 @@
 #ifndef IOUTILITIES_BITREADER_H
 #define IOUTILITIES_BITREADER_H
 
-#include "../global.h"
+#include "./basicbitreader.h"
+
+#include "../misc/math.h"
 
 #include <cstdint>
 #include <ios>
@@ -10,33 +12,43 @@
 
 namespace CppUtilities {
 
-class CPP_UTILITIES_EXPORT BitReader {
+class StreamBitReader;
+class VlcTable;
+
+class CPP_UTILITIES_EXPORT BitReader : public Detail::BasicBitReader<BitReader, Detail::BitOrder::MsbFirst> {
+    friend StreamBitReader;
+    friend VlcTable;
+    friend Detail::BasicBitReader<BitReader, Detail::BitOrder::MsbFirst>;
+
 public:
     BitReader(const char *buffer, std::size_t bufferSize);
     BitReader(const char *buffer, const char *end);
 
-    template <typename intType> intType readBits(std::uint8_t bitCount);
-    std::uint8_t readBit();
+    using BasicBitReader::reset;
     template <typename intType> intType readUnsignedExpGolombCodedBits();
     template <typename intType> intType readSignedExpGolombCodedBits();
-    template <typename intType> intType showBits(std::uint8_t bitCount);
-    void skipBits(std::size_t bitCount);
-    void align();
-    std::size_t bitsAvailable();
-    void reset(const char *buffer, std::size_t bufferSize);
+    template <typename intType> void readUnsignedExpGolombCodedBits(intType *values, std::size_t count);
+    template <typename intType> void readSignedExpGolombCodedBits(intType *values, std::size_t count);
     void reset(const char *buffer, const char *end);
+    bool isSkippingEmulationPreventionBytes() const;
+    void setSkippingEmulationPreventionBytes(bool skipping);
 
 private:
-    const std::uint8_t *m_buffer;
-    const std::uint8_t *m_end;
-    std::uint8_t m_bitsAvail;
+    void locateEmulationPreventionBytes(const std::uint8_t *begin);
+    const std::uint8_t *nextEscape() const;
+    std::size_t remainingEscapes() const;
+    void skipEmulationPreventionByte();
+    std::uint64_t readExpGolombCode();
+    std::uint64_t readLongExpGolombCode();
+
+    const std::uint8_t *m_nextEscape;
+    std::size_t m_remainingEscapes;
+    bool m_skippingEscapes;
 };
 
 /*!
  * \brief Constructs a new BitReader.
- * \remarks
- *  - Does not take ownership over the specified \a buffer.
- *  - bufferSize must be equal or greater than 1.
+ * \remarks Does not take ownership over the specified \a buffer.
  */
 inline BitReader::BitReader(const char *buffer, std::size_t bufferSize)
     : BitReader(buffer, buffer + bufferSize)
@@ -47,130 +59,128 @@ inline BitReader::BitReader(const char *buffer, std::size_t bufferSize)
  * \brief Constructs a new BitReader.
  * \remarks
  *  - Does not take ownership over the specified \a buffer.
- *  - \a end must be greater than \a buffer.
+ *  - \a end must not be less than \a buffer.
  */
 inline BitReader::BitReader(const char *buffer, const char *end)
-    : m_buffer(reinterpret_cast<const std::uint8_t *>(buffer))
-    , m_end(reinterpret_cast<const std::uint8_t *>(end))
-    , m_bitsAvail(8)
+    : BasicBitReader(buffer, end)
+    , m_nextEscape(m_end)
+    , m_remainingEscapes(0)
+    , m_skippingEscapes(false)
 {
 }
 
 /*!
- * \brief Reads the specified number of bits from the buffer advancing the current position by \a bitCount bits.
- * \param bitCount Specifies the number of bits read.
- * \tparam intType Specifies the type of the returned value.
- * \remarks Does not check whether intType is big enough to hold result.
- * \throws Throws ios_base::failure if the end of the buffer is exceeded.
- *         The reader becomes invalid in that case.
+ * \brief Returns the position of the next emulation prevention byte or m_end if there is none (or they are not skipped).
  */
-template <typename intType> intType BitReader::readBits(std::uint8_t bitCount)
+inline const std::uint8_t *BitReader::nextEscape() const
 {
-    intType val = 0;
-    for (std::uint8_t readAtOnce; bitCount; bitCount -= readAtOnce) {
-        if (!m_bitsAvail) {
-            if (++m_buffer >= m_end) {
-                throw std::ios_base::failure("end of buffer exceeded");
-            }
-            m_bitsAvail = 8;
-        }
-        readAtOnce = std::min(bitCount, m_bitsAvail);
-        val = static_cast<intType>(
-            (val << readAtOnce) | static_cast<intType>(((*m_buffer) >> (m_bitsAvail -= readAtOnce)) & (0xFF >> (0x08 - readAtOnce))));
-    }
-    return val;
+    return m_nextEscape;
 }
 
 /*!
- * \brief Reads the one bit from the buffer advancing the current position by one bit.
- * \throws Throws ios_base::failure if the end of the buffer is exceeded.
- *         The reader becomes invalid in that case.
+ * \brief Returns the number of emulation prevention bytes within the remaining buffer.
  */
-inline std::uint8_t BitReader::readBit()
+inline std::size_t BitReader::remainingEscapes() const
 {
-    return readBits<std::uint8_t>(1) == 1;
+    return m_remainingEscapes;
+}
+
+/*!
+ * \brief Reads an "Exp-Golomb coded" code number.
+ *
+ * If the whole code is within the cache (which is always the case for code numbers below 2^28 - 1 unless the end of the
+ * buffer is reached), the length of the prefix is determined via countLeadingZeros() and the code is consumed in one go.
+ * Otherwise readLongExpGolombCode() is used.
+ */
+inline std::uint64_t BitReader::readExpGolombCode()
+{
+    auto codeLength = 2 * countLeadingZeros(m_cache) + 1;
+    if (codeLength > m_cacheBits) {
+        refill();
+        codeLength = 2 * countLeadingZeros(m_cache) + 1;
+        if (codeLength > m_cacheBits) {
+            return readLongExpGolombCode();
+        }
+    }
+    const auto codeNum = (m_cache >> (64 - codeLength)) - 1;
+    consume(static_cast<std::uint8_t>(codeLength));
+    return codeNum;
 }
 
 /*!
  * \brief Reads "Exp-Golomb coded" bits (unsigned).
  * \tparam intType Specifies the type of the returned value.
  * \remarks Does not check whether intType is big enough to hold result.
- * \throws Throws ios_base::failure if the end of the buffer is exceeded.
+ * \throws Throws ios_base::failure if the end of the buffer is exceeded or the value does not fit into 64 bits.
  *         The reader becomes invalid in that case.
  * \sa https://en.wikipedia.org/wiki/Exponential-Golomb_coding
  */
 template <typename intType> intType BitReader::readUnsignedExpGolombCodedBits()
 {
-    std::uint8_t count = 0;
-    while (!readBit()) {
-        ++count;
-    }
-    return count ? static_cast<intType>(((1 << count) | readBits<intType>(count)) - 1) : 0;
+    return static_cast<intType>(readExpGolombCode());
 }
 
 /*!
  * \brief Reads "Exp-Golomb coded" bits (signed).
  * \tparam intType Specifies the type of the returned value which should be signed (obviously).
  * \remarks Does not check whether intType is big enough to hold result.
- * \throws Throws ios_base::failure if the end of the buffer is exceeded.
+ * \throws Throws ios_base::failure if the end of the buffer is exceeded or the value does not fit into 64 bits.
  *         The reader becomes invalid in that case.
  * \sa https://en.wikipedia.org/wiki/Exponential-Golomb_coding
  */
 template <typename intType> intType BitReader::readSignedExpGolombCodedBits()
 {
-    auto value = readUnsignedExpGolombCodedBits<typename std::make_unsigned<intType>::type>();
-    return (value % 2) ? static_cast<intType>((value + 1) / 2) : (-static_cast<intType>(value / 2));
-}
-
-/*!
- * \brief Reads the specified number of bits from the buffer without advancing the current position.
- */
-template <typename intType> intType BitReader::showBits(std::uint8_t bitCount)
-{
-    auto tmp = *this;
-    return tmp.readBits<intType>(bitCount);
+    const auto value = readExpGolombCode();
+    return (value % 2) ? static_cast<intType>((value + 1) / 2) : static_cast<intType>(-static_cast<std::int64_t>(value / 2));
 }
 
 /*!
- * \brief Returns the number of bits which are still available to read.
+ * \brief Reads \a count "Exp-Golomb coded" values (unsigned) into \a values.
+ * \remarks This is useful to decode runs of ue(v) values (e.g. within H.264/HEVC slice headers and parameter sets)
+ *          without a function call per value.
+ * \throws Throws ios_base::failure if the end of the buffer is exceeded or a value does not fit into 64 bits.
+ *         The reader becomes invalid in that case.
  */
-inline std::size_t BitReader::bitsAvailable()
+template <typename intType> void BitReader::readUnsignedExpGolombCodedBits(intType *values, std::size_t count)
 {
-    return m_buffer != m_end ? static_cast<std::size_t>(((m_end - m_buffer - 1) * 8) + m_bitsAvail) : static_cast<std::size_t>(0);
+    for (auto *const end = values + count; values != end; ++values) {
+        *values = readUnsignedExpGolombCodedBits<intType>();
+    }
 }
 
 /*!
- * \brief Resets the reader.
- * \remarks
- *  - Does not take ownership over the specified \a buffer.
- *  - bufferSize must be equal or greater than 1.
+ * \brief Reads \a count "Exp-Golomb coded" values (signed) into \a values.
+ * \remarks This is useful to decode runs of se(v) values without a function call per value.
+ * \throws Throws ios_base::failure if the end of the buffer is exceeded or a value does not fit into 64 bits.
+ *         The reader becomes invalid in that case.
  */
-inline void BitReader::reset(const char *buffer, std::size_t bufferSize)
+template <typename intType> void BitReader::readSignedExpGolombCodedBits(intType *values, std::size_t count)
 {
-    m_buffer = reinterpret_cast<const std::uint8_t *>(buffer);
-    m_end = reinterpret_cast<const std::uint8_t *>(buffer + bufferSize);
-    m_bitsAvail = 8;
+    for (auto *const end = values + count; values != end; ++values) {
+        *values = readSignedExpGolombCodedBits<intType>();
+    }
 }
 
 /*!
  * \brief Resets the reader.
  * \remarks
  *  - Does not take ownership over the specified \a buffer.
- *  - \a end must be greater than \a buffer.
+ *  - \a end must not be less than \a buffer.
+ *  - Whether emulation prevention bytes are skipped is preserved.
  */
 inline void BitReader::reset(const char *buffer, const char *end)
 {
-    m_buffer = reinterpret_cast<const std::uint8_t *>(buffer);
-    m_end = reinterpret_cast<const std::uint8_t *>(end);
-    m_bitsAvail = 8;
+    BasicBitReader::reset(buffer, end);
+    setSkippingEmulationPreventionBytes(m_skippingEscapes);
 }
 
 /*!
- * \brief Re-establishes alignment.
+ * \brief Returns whether emulation prevention bytes are skipped.
+ * \sa setSkippingEmulationPreventionBytes()
  */
-inline void BitReader::align()
+inline bool BitReader::isSkippingEmulationPreventionBytes() const
 {
-    skipBits(m_bitsAvail);
+    return m_skippingEscapes;
 }
 
 } // namespace CppUtilities
@@ -0,0 +1,65 @@
+#include "./bitwriter.h"
+#include "./binarywriter.h"
+
+using namespace std;
+
+namespace CppUtilities {
+
+/*!
+ * \class BitWriter
+ * \brief The BitWriter class provides bitwise writing, e.g. for creating codec configuration headers.
+ *
+ * It is the counterpart of BitReader. Bits are written most significant bit first and accumulated in a 64-bit register
+ * which is emitted as a whole (big endian) word once full. Data is emitted either into an internal buffer or to a
+ * BinaryWriter (which should use a write buffer, see BinaryWriter::setWriteBufferSize()).
+ *
+ * Example:
+ * ```
+ * auto bitWriter = BitWriter();
+ * bitWriter.writeBits(0xFFF, 12); // ADTS sync word
+ * bitWriter.writeBit(false);
+ * // ...
+ * bitWriter.flush();
+ * const auto &header = bitWriter.buffer();
+ * ```
+ */
+
+/*!
+ * \brief Emits all bits written so far padding the last byte with zero bits.
+ * \remarks Afterwards the current position is at a byte boundary.
+ */
+void BitWriter::flush()
+{
+    align();
+    if (!m_bits) {
+        return;
+    }
+    char bytes[8];
+    BE::getBytes(m_accumulator, bytes);
+    const auto size = static_cast<std::size_t>(m_bits / 8);
+    if (m_writer) {
+        m_writer->write(bytes, static_cast<std::streamsize>(size));
+    } else {
+        m_buffer.append(bytes, size);
+    }
+    m_bytesEmitted += size;
+    m_accumulator = 0;
+    m_bits = 0;
+}
+
+/*!
+ * \brief Emits the full accumulator.
+ */
+void BitWriter::emitWord()
+{
+    char bytes[8];
+    BE::getBytes(m_accumulator, bytes);
+    if (m_writer) {
+        m_writer->write(bytes, 8);
+    } else {
+        m_buffer.append(bytes, 8);
+    }
+    m_bytesEmitted += 8;
+}
+
+} // namespace CppUtilities
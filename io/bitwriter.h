@@ -0,0 +1,210 @@
+#ifndef IOUTILITIES_BITWRITER_H
+#define IOUTILITIES_BITWRITER_H
+
+#include "../conversion/binaryconversion.h"
+#include "../conversion/conversionexception.h"
+#include "../global.h"
+#include "../misc/math.h"
+
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <type_traits>
+
+namespace CppUtilities {
+
+class BinaryWriter;
+
+class CPP_UTILITIES_EXPORT BitWriter {
+public:
+    BitWriter();
+    explicit BitWriter(BinaryWriter *writer);
+
+    template <typename intType> void writeBits(intType value, std::uint8_t bitCount);
+    void writeBit(bool value);
+    template <typename intType> void writeUnsignedExpGolombCodedBits(intType value);
+    template <typename intType> void writeSignedExpGolombCodedBits(intType value);
+    void align();
+    void flush();
+    std::uint64_t bitsWritten() const;
+    const std::string &buffer() const;
+    std::string takeBuffer();
+    BinaryWriter *writer();
+    void reset();
+    void reset(BinaryWriter *writer);
+
+private:
+    void appendBits(std::uint64_t value, std::uint8_t bitCount);
+    void emitWord();
+
+    std::uint64_t m_accumulator;
+    std::uint8_t m_bits;
+    std::uint64_t m_bytesEmitted;
+    std::string m_buffer;
+    BinaryWriter *m_writer;
+};
+
+/*!
+ * \brief Constructs a new BitWriter writing into the internal buffer.
+ * \sa buffer(), takeBuffer()
+ */
+inline BitWriter::BitWriter()
+    : BitWriter(nullptr)
+{
+}
+
+/*!
+ * \brief Constructs a new BitWriter writing to the specified \a writer (or into the internal buffer if \a writer is nullptr).
+ * \remarks Does not take ownership over the specified \a writer.
+ */
+inline BitWriter::BitWriter(BinaryWriter *writer)
+    : m_accumulator(0)
+    , m_bits(0)
+    , m_bytesEmitted(0)
+    , m_writer(writer)
+{
+}
+
+/*!
+ * \brief Appends the \a bitCount (at most 64) least significant bits of \a value to the accumulator emitting it when full.
+ * \remarks The bits of \a value above \a bitCount must be zero.
+ */
+inline void BitWriter::appendBits(std::uint64_t value, std::uint8_t bitCount)
+{
+    if (bitCount < 64 - m_bits) {
+        m_accumulator |= value << (63 - m_bits - bitCount) << 1;
+        m_bits = static_cast<std::uint8_t>(m_bits + bitCount);
+        return;
+    }
+    // fill up the accumulator, emit it and keep the remaining bits
+    const auto overflow = static_cast<std::uint8_t>(bitCount - (64 - m_bits));
+    m_accumulator |= value >> overflow;
+    emitWord();
+    m_accumulator = overflow ? value << (64 - overflow) : 0;
+    m_bits = overflow;
+}
+
+/*!
+ * \brief Writes the \a bitCount least significant bits of \a value (most significant bit first).
+ * \param value Specifies the value to write. Bits above \a bitCount are ignored so negative values can be written as
+ *        two's complement.
+ * \param bitCount Specifies the number of bits to write (at most 64).
+ */
+template <typename intType> void BitWriter::writeBits(intType value, std::uint8_t bitCount)
+{
+    static_assert(std::is_integral_v<intType>, "only integers can be written");
+    const auto mask = bitCount ? (~std::uint64_t(0) >> (64 - bitCount)) : std::uint64_t(0);
+    appendBits(static_cast<std::uint64_t>(value) & mask, bitCount);
+}
+
+/*!
+ * \brief Writes one bit.
+ */
+inline void BitWriter::writeBit(bool value)
+{
+    appendBits(value ? 1 : 0, 1);
+}
+
+/*!
+ * \brief Writes \a value as "Exp-Golomb coded" bits (unsigned).
+ * \throws Throws ConversionException if \a value is the maximum of std::uint64_t which can not be encoded.
+ * \sa BitReader::readUnsignedExpGolombCodedBits(), https://en.wikipedia.org/wiki/Exponential-Golomb_coding
+ */
+template <typename intType> void BitWriter::writeUnsignedExpGolombCodedBits(intType value)
+{
+    static_assert(std::is_unsigned_v<intType>, "use writeSignedExpGolombCodedBits() for signed integers");
+    if (static_cast<std::uint64_t>(value) == std::numeric_limits<std::uint64_t>::max()) {
+        throw ConversionException("The value to be Exp-Golomb coded exceeds the maximum.");
+    }
+    const auto codeNum = static_cast<std::uint64_t>(value) + 1;
+    const auto bitCount = static_cast<std::uint8_t>(64 - countLeadingZeros(codeNum));
+    appendBits(0, static_cast<std::uint8_t>(bitCount - 1));
+    appendBits(codeNum, bitCount);
+}
+
+/*!
+ * \brief Writes \a value as "Exp-Golomb coded" bits (signed).
+ * \remarks Positive values are mapped to odd and other values to even code numbers.
+ * \throws Throws ConversionException if \a value is the minimum of std::int64_t which can not be encoded.
+ * \sa BitReader::readSignedExpGolombCodedBits(), https://en.wikipedia.org/wiki/Exponential-Golomb_coding
+ */
+template <typename intType> void BitWriter::writeSignedExpGolombCodedBits(intType value)
+{
+    static_assert(std::is_signed_v<intType>, "use writeUnsignedExpGolombCodedBits() for unsigned integers");
+    // compute the magnitude in unsigned arithmetic so the minimum of std::int64_t does not overflow
+    const auto magnitude = value > 0 ? static_cast<std::uint64_t>(value) : 0 - static_cast<std::uint64_t>(static_cast<std::int64_t>(value));
+    if (magnitude > std::numeric_limits<std::uint64_t>::max() / 2) {
+        throw ConversionException("The value to be Exp-Golomb coded exceeds the maximum.");
+    }
+    writeUnsignedExpGolombCodedBits<std::uint64_t>(value > 0 ? magnitude * 2 - 1 : magnitude * 2);
+}
+
+/*!
+ * \brief Writes zero bits until the current position is at a byte boundary.
+ * \remarks Does nothing if the current position is already at a byte boundary.
+ */
+inline void BitWriter::align()
+{
+    appendBits(0, static_cast<std::uint8_t>((8 - (m_bits % 8)) % 8));
+}
+
+/*!
+ * \brief Returns the number of bits written so far (including bits not emitted yet).
+ */
+inline std::uint64_t BitWriter::bitsWritten() const
+{
+    return m_bytesEmitted * 8 + m_bits;
+}
+
+/*!
+ * \brief Returns the internal buffer.
+ * \remarks Only contains the data which has been emitted so far. Call flush() before to emit all data.
+ */
+inline const std::string &BitWriter::buffer() const
+{
+    return m_buffer;
+}
+
+/*!
+ * \brief Returns the internal buffer leaving the internal buffer empty.
+ * \remarks Only contains the data which has been emitted so far. Call flush() before to emit all data.
+ */
+inline std::string BitWriter::takeBuffer()
+{
+    auto buffer = std::string();
+    buffer.swap(m_buffer);
+    return buffer;
+}
+
+/*!
+ * \brief Returns the BinaryWriter data is written to or nullptr if data is written into the internal buffer.
+ */
+inline BinaryWriter *BitWriter::writer()
+{
+    return m_writer;
+}
+
+/*!
+ * \brief Resets the writer discarding bits which have not been emitted yet and clearing the internal buffer.
+ */
+inline void BitWriter::reset()
+{
+    m_accumulator = 0;
+    m_bits = 0;
+    m_bytesEmitted = 0;
+    m_buffer.clear();
+}
+
+/*!
+ * \brief Resets the writer (see other overload) and assigns the specified \a writer.
+ * \remarks Does not take ownership over the specified \a writer.
+ */
+inline void BitWriter::reset(BinaryWriter *writer)
+{
+    reset();
+    m_writer = writer;
+}
+
+} // namespace CppUtilities
+
+#endif // IOUTILITIES_BITWRITER_H
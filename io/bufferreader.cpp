@@ -0,0 +1,158 @@
+#include "./bufferreader.h"
+#include "./crc32.h"
+
+#include "../conversion/conversionexception.h"
+
+#include <ios>
+
+using namespace std;
+
+namespace CppUtilities {
+
+/*!
+ * \class BufferReader
+ * \brief Reads primitive data types from a buffer which is already in memory.
+ *
+ * This class provides the same read-methods as BinaryReader but operates on a range of memory instead of
+ * a std::istream. Hence each read boils down to a bounds check, an (unaligned) load and possibly a byte swap
+ * which makes it suitable for parsing data which has been read en bloc or memory mapped.
+ *
+ * \remarks
+ * - Supports both, little endian and big endian.
+ * - Does not take ownership over the buffer.
+ * - Reading beyond the end of the buffer throws std::ios_base::failure and leaves the position unaltered.
+ * \sa BinaryReader
+ */
+
+/*!
+ * \brief Throws the exception used to indicate that the end of the buffer has been exceeded.
+ * \remarks Not inlined to keep the code of the inline read-methods small.
+ */
+void BufferReader::throwEndOfBuffer()
+{
+    throw ios_base::failure("end of buffer exceeded");
+}
+
+/*!
+ * \brief Throws the exception used to indicate an invalid length denotation of a variable length unsigned integer.
+ */
+void BufferReader::throwVariableLengthIntegerExceedsMaximum()
+{
+    throw ConversionException("Length denotation of variable length unsigned integer exceeds maximum.");
+}
+
+/*!
+ * \brief Reads up to \a maxCount consecutive big endian variable length unsigned integers into \a values.
+ *
+ * This is useful to decode e.g. a sequence of EBML element IDs and sizes which has been read en bloc. Decoding stops
+ * when the end of the buffer is reached.
+ *
+ * \returns Returns the number of integers which have been read.
+ * \throws Throws ConversionException if the size of an integer exceeds the maximum and std::ios_base::failure if the
+ *         buffer ends within an integer. The position is left after the last integer which could be read in both cases.
+ * \remarks As long as at least 8 bytes remain, each integer is decoded via a single load.
+ */
+std::size_t BufferReader::readVariableLengthUIntsBE(std::uint64_t *values, std::size_t maxCount)
+{
+    auto count = std::size_t();
+    for (const auto *current = m_current; count != maxCount && m_end - current >= 8; ++count, m_current = current) {
+        const auto firstByte = static_cast<std::uint8_t>(*current);
+        if (!firstByte) {
+            throwVariableLengthIntegerExceedsMaximum();
+        }
+        const auto prefixLength = static_cast<unsigned int>(countLeadingZeros(firstByte)) + 1;
+        values[count] = (BE::toInt<std::uint64_t>(current) >> (64 - 8 * prefixLength)) & ((static_cast<std::uint64_t>(1) << (7 * prefixLength)) - 1);
+        current += prefixLength;
+    }
+    for (; count != maxCount && m_current != m_end; ++count) {
+        values[count] = readVariableLengthUIntBE();
+    }
+    return count;
+}
+
+/*!
+ * \brief Reads a LEB128 encoded unsigned integer and advances the current position by one to ten bytes.
+ * \throws Throws ConversionException if the integer exceeds 64 bit and std::ios_base::failure if the end of the buffer
+ *         is exceeded. The position is not altered in both cases.
+ * \sa <a href="https://en.wikipedia.org/wiki/LEB128">LEB128 - Wikipedia</a>
+ */
+std::uint64_t BufferReader::readVarUInt64()
+{
+    auto value = std::uint64_t();
+    if (!fromVarUInt64s(m_current, m_end, &value, 1)) {
+        throwEndOfBuffer();
+    }
+    return value;
+}
+
+/*!
+ * \brief Reads up to \a maxCount consecutive LEB128 encoded unsigned integers into \a values.
+ *
+ * Decoding stops when the end of the buffer is reached.
+ *
+ * \returns Returns the number of integers which have been read.
+ * \throws Throws ConversionException if an integer exceeds 64 bit and std::ios_base::failure if the buffer ends within
+ *         an integer. The position is left after the last integer which could be read in both cases.
+ * \sa fromVarUInt64s() which is used to decode the integers
+ */
+std::size_t BufferReader::readVarUInt64s(std::uint64_t *values, std::size_t maxCount)
+{
+    const auto count = fromVarUInt64s(m_current, m_end, values, maxCount);
+    if (count != maxCount && m_current != m_end) {
+        throwEndOfBuffer();
+    }
+    return count;
+}
+
+/*!
+ * \brief Reads a terminated string.
+ *
+ * Advances the current position by the string length plus one byte. If no termination is found the
+ * remaining bytes of the buffer are returned.
+ *
+ * \param termination The byte to be recognized as termination value.
+ */
+std::string BufferReader::readTerminatedString(std::uint8_t termination)
+{
+    const auto *const begin = m_current;
+    const auto *const terminationPos = static_cast<const char *>(memchr(begin, termination, remainingBytes()));
+    if (!terminationPos) {
+        m_current = m_end;
+        return std::string(begin, m_end);
+    }
+    m_current = terminationPos + 1;
+    return std::string(begin, terminationPos);
+}
+
+/*!
+ * \brief Reads a terminated string.
+ *
+ * Advances the current position by the string length plus one byte but maximal by \a maxBytesToRead.
+ *
+ * \param maxBytesToRead The maximal number of bytes to read.
+ * \param termination The value to be recognized as termination.
+ */
+std::string BufferReader::readTerminatedString(std::size_t maxBytesToRead, std::uint8_t termination)
+{
+    const auto *const begin = m_current;
+    const auto bytesToSearch = min(maxBytesToRead, remainingBytes());
+    const auto *const terminationPos = static_cast<const char *>(memchr(begin, termination, bytesToSearch));
+    if (!terminationPos) {
+        m_current += bytesToSearch;
+        return std::string(begin, m_current);
+    }
+    m_current = terminationPos + 1;
+    return std::string(begin, terminationPos);
+}
+
+/*!
+ * \brief Reads \a length bytes and computes the CRC-32 for that block of data.
+ * \remarks Ogg compatible version
+ * \sa BinaryReader::computeCrc32(), Crc32
+ */
+std::uint32_t BufferReader::readCrc32(std::size_t length)
+{
+    return Crc32::compute(take(length), length, Crc32::Variant::Ogg);
+}
+
+} // namespace CppUtilities
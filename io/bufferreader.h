@@ -0,0 +1,791 @@
+#ifndef IOUTILITIES_BUFFERREADER_H
+#define IOUTILITIES_BUFFERREADER_H
+
+#include "../conversion/binaryconversion.h"
+#include "../misc/math.h"
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+
+namespace CppUtilities {
+
+class CPP_UTILITIES_EXPORT BufferReader {
+public:
+    BufferReader(const char *buffer, std::size_t bufferSize);
+    BufferReader(const char *buffer, const char *end);
+    explicit BufferReader(std::string_view buffer);
+
+    const char *buffer() const;
+    const char *end() const;
+    const char *current() const;
+    std::size_t size() const;
+    std::size_t position() const;
+    std::size_t remainingBytes() const;
+    bool canRead() const;
+    void seek(std::size_t position);
+    void skip(std::size_t count);
+    void reset(const char *buffer, std::size_t bufferSize);
+    void reset(const char *buffer, const char *end);
+    void read(char *buffer, std::size_t length);
+    void read(std::uint8_t *buffer, std::size_t length);
+    std::string_view readView(std::size_t length);
+    std::int16_t readInt16BE();
+    std::uint16_t readUInt16BE();
+    std::int32_t readInt24BE();
+    std::uint32_t readUInt24BE();
+    std::int32_t readInt32BE();
+    std::uint32_t readUInt32BE();
+    std::int64_t readInt40BE();
+    std::uint64_t readUInt40BE();
+    std::int64_t readInt56BE();
+    std::uint64_t readUInt56BE();
+    std::int64_t readInt64BE();
+    std::uint64_t readUInt64BE();
+    std::uint64_t readVariableLengthUIntBE();
+    std::size_t readVariableLengthUIntsBE(std::uint64_t *values, std::size_t maxCount);
+    float readFloat32BE();
+    double readFloat64BE();
+    std::int16_t readInt16LE();
+    std::uint16_t readUInt16LE();
+    std::int32_t readInt24LE();
+    std::uint32_t readUInt24LE();
+    std::int32_t readInt32LE();
+    std::uint32_t readUInt32LE();
+    std::int64_t readInt40LE();
+    std::uint64_t readUInt40LE();
+    std::int64_t readInt56LE();
+    std::uint64_t readUInt56LE();
+    std::int64_t readInt64LE();
+    std::uint64_t readUInt64LE();
+    std::uint64_t readVariableLengthUIntLE();
+    std::uint64_t readVarUInt64();
+    std::int64_t readVarInt64();
+    std::size_t readVarUInt64s(std::uint64_t *values, std::size_t maxCount);
+    float readFloat32LE();
+    double readFloat64LE();
+    char readChar();
+    std::uint8_t readByte();
+    bool readBool();
+    std::string readLengthPrefixedString();
+    std::string readString(std::size_t length);
+    std::string readTerminatedString(std::uint8_t termination = 0);
+    std::string readTerminatedString(std::size_t maxBytesToRead, std::uint8_t termination = 0);
+    std::uint32_t readSynchsafeUInt32BE();
+    float readFixed8BE();
+    float readFixed16BE();
+    std::uint32_t readSynchsafeUInt32LE();
+    float readFixed8LE();
+    float readFixed16LE();
+    std::uint32_t readCrc32(std::size_t length);
+
+    // declare further overloads for read() to ease use of BufferReader in templates
+    void read(char &oneCharacter);
+    void read(std::uint8_t &oneByte);
+    void read(bool &oneBool);
+    void read(std::string &lengthPrefixedString);
+    void read(std::int16_t &one16BitInt);
+    void read(std::uint16_t &one16BitUInt);
+    void read(std::int32_t &one32BitInt);
+    void read(std::uint32_t &one32BitUInt);
+    void read(std::int64_t &one64BitInt);
+    void read(std::uint64_t &one64BitUInt);
+    void read(float &one32BitFloat);
+    void read(double &one64BitFloat);
+
+private:
+    const char *take(std::size_t count);
+    std::size_t variableLengthIntegerSize() const;
+    [[noreturn]] static void throwEndOfBuffer();
+    [[noreturn]] static void throwVariableLengthIntegerExceedsMaximum();
+
+    const char *m_buffer;
+    const char *m_current;
+    const char *m_end;
+};
+
+/*!
+ * \brief Constructs a new BufferReader for the specified \a buffer.
+ * \remarks Does not take ownership over the specified \a buffer.
+ */
+inline BufferReader::BufferReader(const char *buffer, std::size_t bufferSize)
+    : BufferReader(buffer, buffer + bufferSize)
+{
+}
+
+/*!
+ * \brief Constructs a new BufferReader for the range from \a buffer to \a end.
+ * \remarks
+ *  - Does not take ownership over the specified \a buffer.
+ *  - \a end must be greater or equal to \a buffer.
+ */
+inline BufferReader::BufferReader(const char *buffer, const char *end)
+    : m_buffer(buffer)
+    , m_current(buffer)
+    , m_end(end)
+{
+}
+
+/*!
+ * \brief Constructs a new BufferReader for the specified \a buffer.
+ * \remarks Does not take ownership over the data the specified \a buffer refers to.
+ */
+inline BufferReader::BufferReader(std::string_view buffer)
+    : BufferReader(buffer.data(), buffer.size())
+{
+}
+
+/*!
+ * \brief Returns the begin of the buffer the reader reads from.
+ */
+inline const char *BufferReader::buffer() const
+{
+    return m_buffer;
+}
+
+/*!
+ * \brief Returns the end of the buffer the reader reads from.
+ */
+inline const char *BufferReader::end() const
+{
+    return m_end;
+}
+
+/*!
+ * \brief Returns a pointer to the byte the next read-method will start reading at.
+ */
+inline const char *BufferReader::current() const
+{
+    return m_current;
+}
+
+/*!
+ * \brief Returns the size of the buffer the reader reads from.
+ */
+inline std::size_t BufferReader::size() const
+{
+    return static_cast<std::size_t>(m_end - m_buffer);
+}
+
+/*!
+ * \brief Returns the offset of the current position from the begin of the buffer.
+ */
+inline std::size_t BufferReader::position() const
+{
+    return static_cast<std::size_t>(m_current - m_buffer);
+}
+
+/*!
+ * \brief Returns the number of bytes which are still available to read.
+ */
+inline std::size_t BufferReader::remainingBytes() const
+{
+    return static_cast<std::size_t>(m_end - m_current);
+}
+
+/*!
+ * \brief Returns whether there is at least one byte left to read.
+ */
+inline bool BufferReader::canRead() const
+{
+    return m_current != m_end;
+}
+
+/*!
+ * \brief Sets the current position to the specified offset from the begin of the buffer.
+ * \throws Throws std::ios_base::failure if \a position exceeds the size of the buffer.
+ */
+inline void BufferReader::seek(std::size_t position)
+{
+    if (position > size()) {
+        throwEndOfBuffer();
+    }
+    m_current = m_buffer + position;
+}
+
+/*!
+ * \brief Advances the current position by \a count bytes without reading them.
+ * \throws Throws std::ios_base::failure if the end of the buffer is exceeded.
+ */
+inline void BufferReader::skip(std::size_t count)
+{
+    take(count);
+}
+
+/*!
+ * \brief Resets the reader to read from the specified \a buffer.
+ * \remarks Does not take ownership over the specified \a buffer.
+ */
+inline void BufferReader::reset(const char *buffer, std::size_t bufferSize)
+{
+    reset(buffer, buffer + bufferSize);
+}
+
+/*!
+ * \brief Resets the reader to read from the range from \a buffer to \a end.
+ * \remarks Does not take ownership over the specified \a buffer.
+ */
+inline void BufferReader::reset(const char *buffer, const char *end)
+{
+    m_buffer = m_current = buffer;
+    m_end = end;
+}
+
+/*!
+ * \brief Returns the number of bytes the variable-length integer at the current position occupies.
+ * \throws Throws ConversionException if the size of the integer exceeds the maximum and std::ios_base::failure if the
+ *         end of the buffer is exceeded.
+ */
+inline std::size_t BufferReader::variableLengthIntegerSize() const
+{
+    if (m_current == m_end) {
+        throwEndOfBuffer();
+    }
+    const auto firstByte = static_cast<std::uint8_t>(*m_current);
+    if (!firstByte) {
+        throwVariableLengthIntegerExceedsMaximum();
+    }
+    return static_cast<std::size_t>(countLeadingZeros(firstByte)) + 1;
+}
+
+/*!
+ * \brief Returns a pointer to the next \a count bytes and advances the current position accordingly.
+ * \remarks This is the only place where bounds are checked; all read-methods go through it exactly once.
+ * \throws Throws std::ios_base::failure if the end of the buffer is exceeded. The position is not
+ *         altered in that case.
+ */
+inline const char *BufferReader::take(std::size_t count)
+{
+    if (count > remainingBytes()) {
+        throwEndOfBuffer();
+    }
+    const auto *const data = m_current;
+    m_current += count;
+    return data;
+}
+
+/*!
+ * \brief Copies the specified number of characters into the specified \a buffer.
+ * \throws Throws std::ios_base::failure if the end of the buffer is exceeded.
+ */
+inline void BufferReader::read(char *buffer, std::size_t length)
+{
+    std::memcpy(buffer, take(length), length);
+}
+
+/*!
+ * \brief Copies the specified number of bytes into the specified \a buffer.
+ * \throws Throws std::ios_base::failure if the end of the buffer is exceeded.
+ */
+inline void BufferReader::read(std::uint8_t *buffer, std::size_t length)
+{
+    std::memcpy(buffer, take(length), length);
+}
+
+/*!
+ * \brief Returns a view of the next \a length bytes without copying them and advances the current position accordingly.
+ * \remarks The returned view is only valid as long as the underlying buffer is valid.
+ * \throws Throws std::ios_base::failure if the end of the buffer is exceeded.
+ */
+inline std::string_view BufferReader::readView(std::size_t length)
+{
+    return std::string_view(take(length), length);
+}
+
+/*!
+ * \brief Reads a 16-bit big endian signed integer and advances the current position by two bytes.
+ */
+inline std::int16_t BufferReader::readInt16BE()
+{
+    return BE::toInt<std::int16_t>(take(sizeof(std::int16_t)));
+}
+
+/*!
+ * \brief Reads a 16-bit big endian unsigned integer and advances the current position by two bytes.
+ */
+inline std::uint16_t BufferReader::readUInt16BE()
+{
+    return BE::toInt<std::uint16_t>(take(sizeof(std::uint16_t)));
+}
+
+/*!
+ * \brief Reads a 24-bit big endian signed integer and advances the current position by three bytes.
+ */
+inline std::int32_t BufferReader::readInt24BE()
+{
+    auto val = static_cast<std::int32_t>(BE::toUInt24(take(3)));
+    if (val >= 0x800000) {
+        val = -(0x1000000 - val);
+    }
+    return val;
+}
+
+/*!
+ * \brief Reads a 24-bit big endian unsigned integer and advances the current position by three bytes.
+ */
+inline std::uint32_t BufferReader::readUInt24BE()
+{
+    return BE::toUInt24(take(3));
+}
+
+/*!
+ * \brief Reads a 32-bit big endian signed integer and advances the current position by four bytes.
+ */
+inline std::int32_t BufferReader::readInt32BE()
+{
+    return BE::toInt<std::int32_t>(take(sizeof(std::int32_t)));
+}
+
+/*!
+ * \brief Reads a 32-bit big endian unsigned integer and advances the current position by four bytes.
+ */
+inline std::uint32_t BufferReader::readUInt32BE()
+{
+    return BE::toInt<std::uint32_t>(take(sizeof(std::uint32_t)));
+}
+
+/*!
+ * \brief Reads a 40-bit big endian signed integer and advances the current position by five bytes.
+ */
+inline std::int64_t BufferReader::readInt40BE()
+{
+    auto val = static_cast<std::int64_t>(readUInt40BE());
+    if (val >= 0x8000000000) {
+        val = -(0x10000000000 - val);
+    }
+    return val;
+}
+
+/*!
+ * \brief Reads a 40-bit big endian unsigned integer and advances the current position by five bytes.
+ */
+inline std::uint64_t BufferReader::readUInt40BE()
+{
+    char buffer[8] = { 0 };
+    std::memcpy(buffer + 3, take(5), 5);
+    return BE::toInt<std::uint64_t>(buffer);
+}
+
+/*!
+ * \brief Reads a 56-bit big endian signed integer and advances the current position by seven bytes.
+ */
+inline std::int64_t BufferReader::readInt56BE()
+{
+    auto val = static_cast<std::int64_t>(readUInt56BE());
+    if (val >= 0x80000000000000) {
+        val = -(0x100000000000000 - val);
+    }
+    return val;
+}
+
+/*!
+ * \brief Reads a 56-bit big endian unsigned integer and advances the current position by seven bytes.
+ */
+inline std::uint64_t BufferReader::readUInt56BE()
+{
+    char buffer[8] = { 0 };
+    std::memcpy(buffer + 1, take(7), 7);
+    return BE::toInt<std::uint64_t>(buffer);
+}
+
+/*!
+ * \brief Reads a 64-bit big endian signed integer and advances the current position by eight bytes.
+ */
+inline std::int64_t BufferReader::readInt64BE()
+{
+    return BE::toInt<std::int64_t>(take(sizeof(std::int64_t)));
+}
+
+/*!
+ * \brief Reads a 64-bit big endian unsigned integer and advances the current position by eight bytes.
+ */
+inline std::uint64_t BufferReader::readUInt64BE()
+{
+    return BE::toInt<std::uint64_t>(take(sizeof(std::uint64_t)));
+}
+
+/*!
+ * \brief Reads an up to 8 byte long big endian unsigned integer and advances the current position by one to eight bytes.
+ * \throws Throws ConversionException if the size of the integer exceeds the maximum and std::ios_base::failure if the
+ *         end of the buffer is exceeded. The position is not altered in both cases.
+ */
+inline std::uint64_t BufferReader::readVariableLengthUIntBE()
+{
+    const auto prefixLength = variableLengthIntegerSize();
+    if (remainingBytes() >= sizeof(std::uint64_t)) {
+        // decode via a single load shifting out the bytes following the integer and masking out the length denotation
+        const auto value = BE::toInt<std::uint64_t>(m_current) >> (64 - 8 * prefixLength);
+        m_current += prefixLength;
+        return value & ((static_cast<std::uint64_t>(1) << (7 * prefixLength)) - 1);
+    }
+    char buffer[8] = { 0 };
+    std::memcpy(buffer + (8 - prefixLength), take(prefixLength), prefixLength);
+    buffer[8 - prefixLength] ^= static_cast<char>(0x80 >> (prefixLength - 1));
+    return BE::toInt<std::uint64_t>(buffer);
+}
+
+/*!
+ * \brief Reads a 32-bit big endian floating point value and advances the current position by four bytes.
+ */
+inline float BufferReader::readFloat32BE()
+{
+    return BE::toFloat32(take(sizeof(float)));
+}
+
+/*!
+ * \brief Reads a 64-bit big endian floating point value and advances the current position by eight bytes.
+ */
+inline double BufferReader::readFloat64BE()
+{
+    return BE::toFloat64(take(sizeof(double)));
+}
+
+/*!
+ * \brief Reads a 16-bit little endian signed integer and advances the current position by two bytes.
+ */
+inline std::int16_t BufferReader::readInt16LE()
+{
+    return LE::toInt<std::int16_t>(take(sizeof(std::int16_t)));
+}
+
+/*!
+ * \brief Reads a 16-bit little endian unsigned integer and advances the current position by two bytes.
+ */
+inline std::uint16_t BufferReader::readUInt16LE()
+{
+    return LE::toInt<std::uint16_t>(take(sizeof(std::uint16_t)));
+}
+
+/*!
+ * \brief Reads a 24-bit little endian signed integer and advances the current position by three bytes.
+ */
+inline std::int32_t BufferReader::readInt24LE()
+{
+    auto val = static_cast<std::int32_t>(LE::toUInt24(take(3)));
+    if (val >= 0x800000) {
+        val = -(0x1000000 - val);
+    }
+    return val;
+}
+
+/*!
+ * \brief Reads a 24-bit little endian unsigned integer and advances the current position by three bytes.
+ */
+inline std::uint32_t BufferReader::readUInt24LE()
+{
+    return LE::toUInt24(take(3));
+}
+
+/*!
+ * \brief Reads a 32-bit little endian signed integer and advances the current position by four bytes.
+ */
+inline std::int32_t BufferReader::readInt32LE()
+{
+    return LE::toInt<std::int32_t>(take(sizeof(std::int32_t)));
+}
+
+/*!
+ * \brief Reads a 32-bit little endian unsigned integer and advances the current position by four bytes.
+ */
+inline std::uint32_t BufferReader::readUInt32LE()
+{
+    return LE::toInt<std::uint32_t>(take(sizeof(std::uint32_t)));
+}
+
+/*!
+ * \brief Reads a 40-bit little endian signed integer and advances the current position by five bytes.
+ */
+inline std::int64_t BufferReader::readInt40LE()
+{
+    auto val = static_cast<std::int64_t>(readUInt40LE());
+    if (val >= 0x8000000000) {
+        val = -(0x10000000000 - val);
+    }
+    return val;
+}
+
+/*!
+ * \brief Reads a 40-bit little endian unsigned integer and advances the current position by five bytes.
+ */
+inline std::uint64_t BufferReader::readUInt40LE()
+{
+    char buffer[8] = { 0 };
+    std::memcpy(buffer, take(5), 5);
+    return LE::toInt<std::uint64_t>(buffer);
+}
+
+/*!
+ * \brief Reads a 56-bit little endian signed integer and advances the current position by seven bytes.
+ */
+inline std::int64_t BufferReader::readInt56LE()
+{
+    auto val = static_cast<std::int64_t>(readUInt56LE());
+    if (val >= 0x80000000000000) {
+        val = -(0x100000000000000 - val);
+    }
+    return val;
+}
+
+/*!
+ * \brief Reads a 56-bit little endian unsigned integer and advances the current position by seven bytes.
+ */
+inline std::uint64_t BufferReader::readUInt56LE()
+{
+    char buffer[8] = { 0 };
+    std::memcpy(buffer, take(7), 7);
+    return LE::toInt<std::uint64_t>(buffer);
+}
+
+/*!
+ * \brief Reads a 64-bit little endian signed integer and advances the current position by eight bytes.
+ */
+inline std::int64_t BufferReader::readInt64LE()
+{
+    return LE::toInt<std::int64_t>(take(sizeof(std::int64_t)));
+}
+
+/*!
+ * \brief Reads a 64-bit little endian unsigned integer and advances the current position by eight bytes.
+ */
+inline std::uint64_t BufferReader::readUInt64LE()
+{
+    return LE::toInt<std::uint64_t>(take(sizeof(std::uint64_t)));
+}
+
+/*!
+ * \brief Reads an up to 8 byte long little endian unsigned integer and advances the current position by one to eight bytes.
+ * \throws Throws ConversionException if the size of the integer exceeds the maximum and std::ios_base::failure if the
+ *         end of the buffer is exceeded. The position is not altered in both cases.
+ */
+inline std::uint64_t BufferReader::readVariableLengthUIntLE()
+{
+    const auto prefixLength = variableLengthIntegerSize();
+    char buffer[8] = { 0 };
+    std::memcpy(buffer + (8 - prefixLength), take(prefixLength), prefixLength);
+    buffer[8 - prefixLength] ^= static_cast<char>(0x80 >> (prefixLength - 1));
+    return LE::toInt<std::uint64_t>(buffer);
+}
+
+/*!
+ * \brief Reads a ZigZag and LEB128 encoded signed integer and advances the current position by one to ten bytes.
+ * \throws Throws ConversionException if the integer exceeds 64 bit and std::ios_base::failure if the end of the buffer
+ *         is exceeded. The position is not altered in both cases.
+ * \sa readVarUInt64(), fromZigZagInt()
+ */
+inline std::int64_t BufferReader::readVarInt64()
+{
+    return fromZigZagInt(readVarUInt64());
+}
+
+/*!
+ * \brief Reads a 32-bit little endian floating point value and advances the current position by four bytes.
+ */
+inline float BufferReader::readFloat32LE()
+{
+    return LE::toFloat32(take(sizeof(float)));
+}
+
+/*!
+ * \brief Reads a 64-bit little endian floating point value and advances the current position by eight bytes.
+ */
+inline double BufferReader::readFloat64LE()
+{
+    return LE::toFloat64(take(sizeof(double)));
+}
+
+/*!
+ * \brief Reads a single character and advances the current position by one byte.
+ */
+inline char BufferReader::readChar()
+{
+    return *take(1);
+}
+
+/*!
+ * \brief Reads a single byte/unsigned character and advances the current position by one byte.
+ */
+inline std::uint8_t BufferReader::readByte()
+{
+    return static_cast<std::uint8_t>(*take(1));
+}
+
+/*!
+ * \brief Reads a boolean value and advances the current position by one byte.
+ */
+inline bool BufferReader::readBool()
+{
+    return readByte() != 0;
+}
+
+/*!
+ * \brief Reads a length prefixed string.
+ * \remarks Reads the length prefix and then a string of the denoted length.
+ *          Advances the current position by the denoted length of the string plus the prefix length.
+ */
+inline std::string BufferReader::readLengthPrefixedString()
+{
+    return readString(readVariableLengthUIntBE());
+}
+
+/*!
+ * \brief Reads a string of the given \a length and advances the current position by \a length bytes.
+ */
+inline std::string BufferReader::readString(std::size_t length)
+{
+    return std::string(take(length), length);
+}
+
+/*!
+ * \brief Reads a 32-bit big endian synchsafe integer and advances the current position by four bytes.
+ * \remarks Synchsafe integers appear in ID3 tags that are attached to an MP3 file.
+ * \sa <a href="http://id3.org/id3v2.4.0-structure">ID3 tag version 2.4.0 - Main Structure</a>
+ */
+inline std::uint32_t BufferReader::readSynchsafeUInt32BE()
+{
+    return toNormalInt(readUInt32BE());
+}
+
+/*!
+ * \brief Reads a 8.8 fixed point big endian representation and returns it as 32-bit floating point value.
+ */
+inline float BufferReader::readFixed8BE()
+{
+    return toFloat32(readUInt16BE());
+}
+
+/*!
+ * \brief Reads a 16.16 fixed point big endian representation and returns it as 32-bit floating point value.
+ */
+inline float BufferReader::readFixed16BE()
+{
+    return toFloat32(readUInt32BE());
+}
+
+/*!
+ * \brief Reads a 32-bit little endian synchsafe integer and advances the current position by four bytes.
+ * \remarks Synchsafe integers appear in ID3 tags that are attached to an MP3 file.
+ * \sa <a href="http://id3.org/id3v2.4.0-structure">ID3 tag version 2.4.0 - Main Structure</a>
+ */
+inline std::uint32_t BufferReader::readSynchsafeUInt32LE()
+{
+    return toNormalInt(readUInt32LE());
+}
+
+/*!
+ * \brief Reads a 8.8 fixed point little endian representation and returns it as 32-bit floating point value.
+ */
+inline float BufferReader::readFixed8LE()
+{
+    return toFloat32(readUInt16LE());
+}
+
+/*!
+ * \brief Reads a 16.16 fixed point little endian representation and returns it as 32-bit floating point value.
+ */
+inline float BufferReader::readFixed16LE()
+{
+    return toFloat32(readUInt32LE());
+}
+
+/*!
+ * \brief Reads a single character and advances the current position by one byte.
+ */
+inline void BufferReader::read(char &oneCharacter)
+{
+    oneCharacter = readChar();
+}
+
+/*!
+ * \brief Reads a single byte/unsigned character and advances the current position by one byte.
+ */
+inline void BufferReader::read(std::uint8_t &oneByte)
+{
+    oneByte = readByte();
+}
+
+/*!
+ * \brief Reads a boolean value and advances the current position by one byte.
+ */
+inline void BufferReader::read(bool &oneBool)
+{
+    oneBool = readBool();
+}
+
+/*!
+ * \brief Reads a length prefixed string.
+ * \remarks Reads the length prefix and then a string of the denoted length.
+ *          Advances the current position by the denoted length of the string plus the prefix length.
+ */
+inline void BufferReader::read(std::string &lengthPrefixedString)
+{
+    lengthPrefixedString = readLengthPrefixedString();
+}
+
+/*!
+ * \brief Reads a 16-bit big endian signed integer and advances the current position by two bytes.
+ */
+inline void BufferReader::read(std::int16_t &one16BitInt)
+{
+    one16BitInt = readInt16BE();
+}
+
+/*!
+ * \brief Reads a 16-bit big endian unsigned integer and advances the current position by two bytes.
+ */
+inline void BufferReader::read(std::uint16_t &one16BitUInt)
+{
+    one16BitUInt = readUInt16BE();
+}
+
+/*!
+ * \brief Reads a 32-bit big endian signed integer and advances the current position by four bytes.
+ */
+inline void BufferReader::read(std::int32_t &one32BitInt)
+{
+    one32BitInt = readInt32BE();
+}
+
+/*!
+ * \brief Reads a 32-bit big endian unsigned integer and advances the current position by four bytes.
+ */
+inline void BufferReader::read(std::uint32_t &one32BitUInt)
+{
+    one32BitUInt = readUInt32BE();
+}
+
+/*!
+ * \brief Reads a 64-bit big endian signed integer and advances the current position by eight bytes.
+ */
+inline void BufferReader::read(std::int64_t &one64BitInt)
+{
+    one64BitInt = readInt64BE();
+}
+
+/*!
+ * \brief Reads a 64-bit big endian unsigned integer and advances the current position by eight bytes.
+ */
+inline void BufferReader::read(std::uint64_t &one64BitUInt)
+{
+    one64BitUInt = readUInt64BE();
+}
+
+/*!
+ * \brief Reads a 32-bit big endian floating point value and advances the current position by four bytes.
+ */
+inline void BufferReader::read(float &one32BitFloat)
+{
+    one32BitFloat = readFloat32BE();
+}
+
+/*!
+ * \brief Reads a 64-bit big endian floating point value and advances the current position by eight bytes.
+ */
+inline void BufferReader::read(double &one64BitFloat)
+{
+    one64BitFloat = readFloat64BE();
+}
+
+} // namespace CppUtilities
+
+#endif // IOUTILITIES_BUFFERREADER_H
@@ -0,0 +1,266 @@
+#include "./checksum.h"
+
+#include "../conversion/binaryconversion.h"
+#include "../misc/cpufeaturesprivate.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace CppUtilities {
+
+/*!
+ * \class Crc32c
+ * \brief Computes the CRC-32C (Castagnoli) checksum incrementally.
+ *
+ * This is a convenience wrapper around Crc32 using Crc32::Variant::Castagnoli. On x86 CPUs supporting SSE4.2 the
+ * checksum is computed via the dedicated crc32 instruction which is selected at runtime.
+ */
+
+/*!
+ * \class Adler32
+ * \brief Computes the Adler-32 checksum (as used by zlib) incrementally.
+ *
+ * On x86 CPUs supporting SSSE3 or AVX2 the sums are computed on 16 or 32 bytes at once which is selected at runtime.
+ */
+
+/*!
+ * \class XxHash64
+ * \brief Computes the 64-bit xxHash (XXH64) incrementally.
+ *
+ * XXH64 is a fast non-cryptographic hash function. It is suitable for e.g. detecting duplicate content but must not
+ * be used where resistance against deliberate collisions is required.
+ *
+ * \sa https://github.com/Cyan4973/xxHash/blob/dev/doc/xxhash_spec.md
+ */
+
+/// \cond
+namespace Detail {
+
+/// \brief The largest prime smaller than 65536.
+constexpr std::uint32_t adler32Base = 65521;
+/// \brief The largest n such that 255n(n+1)/2 + (n+1)(adler32Base-1) fits into 32 bits so the modulo can be deferred.
+constexpr std::size_t adler32MaxBlockSize = 5552;
+
+/*!
+ * \brief Updates the sums \a a and \a b byte-by-byte without reducing them.
+ */
+inline void adler32UpdateScalar(std::uint32_t &a, std::uint32_t &b, const std::uint8_t *data, std::size_t size)
+{
+    for (const auto *const end = data + size; data != end; ++data) {
+        a += *data;
+        b += a;
+    }
+}
+
+#ifdef CPP_UTILITIES_X86_DISPATCH
+/*!
+ * \brief Returns the sum of the 32-bit lanes of \a value.
+ */
+CPP_UTILITIES_TARGET("ssse3") inline std::uint32_t adler32HorizontalSum(__m128i value)
+{
+    value = _mm_add_epi32(value, _mm_shuffle_epi32(value, _MM_SHUFFLE(1, 0, 3, 2)));
+    value = _mm_add_epi32(value, _mm_shuffle_epi32(value, _MM_SHUFFLE(2, 3, 0, 1)));
+    return static_cast<std::uint32_t>(_mm_cvtsi128_si32(value));
+}
+
+/*!
+ * \brief Updates the sums \a a and \a b processing 16 bytes per iteration.
+ * \remarks
+ * - For each block, the sum of the bytes is added to \a a and the bytes weighted by 16, 15, ..., 1 are added
+ *   to \a b. Additionally, \a b needs to be incremented by 16 times \a a as it was before the block which is
+ *   accumulated separately.
+ * - All lanes only hold parts of the sums computed by adler32UpdateScalar() so they can not overflow either.
+ */
+CPP_UTILITIES_TARGET("ssse3") void adler32UpdateSsse3(std::uint32_t &a, std::uint32_t &b, const std::uint8_t *data, std::size_t size)
+{
+    const auto weights = _mm_setr_epi8(16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1);
+    const auto ones = _mm_set1_epi16(1);
+    const auto zero = _mm_setzero_si128();
+    const auto blocks = size / 16;
+    auto sums = zero, previousSums = zero, weightedSums = zero;
+    for (const auto *const end = data + blocks * 16; data != end; data += 16) {
+        const auto bytes = _mm_loadu_si128(reinterpret_cast<const __m128i *>(data));
+        previousSums = _mm_add_epi32(previousSums, sums);
+        sums = _mm_add_epi32(sums, _mm_sad_epu8(bytes, zero));
+        weightedSums = _mm_add_epi32(weightedSums, _mm_madd_epi16(_mm_maddubs_epi16(bytes, weights), ones));
+    }
+    b += a * static_cast<std::uint32_t>(blocks * 16) + adler32HorizontalSum(_mm_add_epi32(weightedSums, _mm_slli_epi32(previousSums, 4)));
+    a += adler32HorizontalSum(sums);
+    adler32UpdateScalar(a, b, data, size % 16);
+}
+
+/*!
+ * \brief Updates the sums \a a and \a b processing 32 bytes per iteration.
+ * \sa adler32UpdateSsse3()
+ */
+CPP_UTILITIES_TARGET("avx2") void adler32UpdateAvx2(std::uint32_t &a, std::uint32_t &b, const std::uint8_t *data, std::size_t size)
+{
+    const auto weights = _mm256_setr_epi8(32, 31, 30, 29, 28, 27, 26, 25, 24, 23, 22, 21, 20, 19, 18, 17, 16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6,
+        5, 4, 3, 2, 1);
+    const auto ones = _mm256_set1_epi16(1);
+    const auto zero = _mm256_setzero_si256();
+    const auto blocks = size / 32;
+    auto sums = zero, previousSums = zero, weightedSums = zero;
+    for (const auto *const end = data + blocks * 32; data != end; data += 32) {
+        const auto bytes = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(data));
+        previousSums = _mm256_add_epi32(previousSums, sums);
+        sums = _mm256_add_epi32(sums, _mm256_sad_epu8(bytes, zero));
+        weightedSums = _mm256_add_epi32(weightedSums, _mm256_madd_epi16(_mm256_maddubs_epi16(bytes, weights), ones));
+    }
+    weightedSums = _mm256_add_epi32(weightedSums, _mm256_slli_epi32(previousSums, 5));
+    b += a * static_cast<std::uint32_t>(blocks * 32)
+        + adler32HorizontalSum(_mm_add_epi32(_mm256_castsi256_si128(weightedSums), _mm256_extracti128_si256(weightedSums, 1)));
+    a += adler32HorizontalSum(_mm_add_epi32(_mm256_castsi256_si128(sums), _mm256_extracti128_si256(sums, 1)));
+    adler32UpdateScalar(a, b, data, size % 32);
+}
+#endif
+
+/// \brief The primes used by XXH64.
+constexpr std::uint64_t xxHash64Primes[] = { 0x9E3779B185EBCA87u, 0xC2B2AE3D27D4EB4Fu, 0x165667B19E3779F9u, 0x85EBCA77C2B2AE63u, 0x27D4EB2F165667C5u };
+
+constexpr std::uint64_t xxHash64RotateLeft(std::uint64_t value, int bits)
+{
+    return (value << bits) | (value >> (64 - bits));
+}
+
+constexpr std::uint64_t xxHash64Round(std::uint64_t accumulator, std::uint64_t input)
+{
+    return xxHash64RotateLeft(accumulator + input * xxHash64Primes[1], 31) * xxHash64Primes[0];
+}
+
+constexpr std::uint64_t xxHash64MergeRound(std::uint64_t accumulator, std::uint64_t value)
+{
+    return (accumulator ^ xxHash64Round(0, value)) * xxHash64Primes[0] + xxHash64Primes[3];
+}
+
+/*!
+ * \brief Consumes as many 32-byte stripes of \a data as possible updating the specified \a accumulators.
+ * \returns Returns the number of bytes consumed.
+ */
+inline std::size_t xxHash64ConsumeStripes(std::uint64_t (&accumulators)[4], const char *data, std::size_t size)
+{
+    auto a0 = accumulators[0], a1 = accumulators[1], a2 = accumulators[2], a3 = accumulators[3];
+    const auto consumed = size - size % 32;
+    for (const auto *const end = data + consumed; data != end; data += 32) {
+        a0 = xxHash64Round(a0, LE::toUInt64(data));
+        a1 = xxHash64Round(a1, LE::toUInt64(data + 8));
+        a2 = xxHash64Round(a2, LE::toUInt64(data + 16));
+        a3 = xxHash64Round(a3, LE::toUInt64(data + 24));
+    }
+    accumulators[0] = a0;
+    accumulators[1] = a1;
+    accumulators[2] = a2;
+    accumulators[3] = a3;
+    return consumed;
+}
+
+} // namespace Detail
+/// \endcond
+
+/*!
+ * \brief Updates the checksum with the specified \a data.
+ */
+void Adler32::update(const char *data, std::size_t size)
+{
+    auto a = m_state & 0xFFFF, b = m_state >> 16;
+    for (const auto *bytes = reinterpret_cast<const std::uint8_t *>(data); size;) {
+        const auto blockSize = std::min(size, Detail::adler32MaxBlockSize);
+#ifdef CPP_UTILITIES_X86_DISPATCH
+        if (CpuFeatures::hasAvx2()) {
+            Detail::adler32UpdateAvx2(a, b, bytes, blockSize);
+        } else if (CpuFeatures::hasSsse3()) {
+            Detail::adler32UpdateSsse3(a, b, bytes, blockSize);
+        } else
+#endif
+        {
+            Detail::adler32UpdateScalar(a, b, bytes, blockSize);
+        }
+        a %= Detail::adler32Base;
+        b %= Detail::adler32Base;
+        bytes += blockSize;
+        size -= blockSize;
+    }
+    m_state = (b << 16) | a;
+}
+
+/*!
+ * \brief Resets the state so a new hash can be computed (using the same seed).
+ */
+void XxHash64::reset()
+{
+    m_accumulators[0] = m_seed + Detail::xxHash64Primes[0] + Detail::xxHash64Primes[1];
+    m_accumulators[1] = m_seed + Detail::xxHash64Primes[1];
+    m_accumulators[2] = m_seed;
+    m_accumulators[3] = m_seed - Detail::xxHash64Primes[0];
+    m_totalSize = 0;
+    m_bufferSize = 0;
+}
+
+/*!
+ * \brief Updates the hash with the specified \a data.
+ * \remarks Data is processed in stripes of 32 bytes. Incomplete stripes are buffered until the next update.
+ */
+void XxHash64::update(const char *data, std::size_t size)
+{
+    m_totalSize += size;
+    if (m_bufferSize) {
+        const auto bytesToBuffer = std::min(size, sizeof(m_buffer) - m_bufferSize);
+        std::memcpy(m_buffer + m_bufferSize, data, bytesToBuffer);
+        m_bufferSize += bytesToBuffer;
+        data += bytesToBuffer;
+        size -= bytesToBuffer;
+        if (m_bufferSize < sizeof(m_buffer)) {
+            return;
+        }
+        Detail::xxHash64ConsumeStripes(m_accumulators, m_buffer, sizeof(m_buffer));
+        m_bufferSize = 0;
+    }
+    const auto consumed = Detail::xxHash64ConsumeStripes(m_accumulators, data, size);
+    if ((m_bufferSize = size - consumed)) {
+        std::memcpy(m_buffer, data + consumed, m_bufferSize);
+    }
+}
+
+/*!
+ * \brief Returns the hash of the data passed to update() so far.
+ */
+std::uint64_t XxHash64::finalize() const
+{
+    using namespace Detail;
+    auto hash = std::uint64_t();
+    if (m_totalSize >= 32) {
+        hash = xxHash64RotateLeft(m_accumulators[0], 1) + xxHash64RotateLeft(m_accumulators[1], 7) + xxHash64RotateLeft(m_accumulators[2], 12)
+            + xxHash64RotateLeft(m_accumulators[3], 18);
+        for (const auto accumulator : m_accumulators) {
+            hash = xxHash64MergeRound(hash, accumulator);
+        }
+    } else {
+        hash = m_seed + xxHash64Primes[4];
+    }
+    hash += m_totalSize;
+
+    // process remaining bytes which do not form a complete stripe
+    const auto *data = m_buffer;
+    auto size = m_bufferSize;
+    for (; size >= 8; data += 8, size -= 8) {
+        hash = xxHash64RotateLeft(hash ^ xxHash64Round(0, LE::toUInt64(data)), 27) * xxHash64Primes[0] + xxHash64Primes[3];
+    }
+    if (size >= 4) {
+        hash = xxHash64RotateLeft(hash ^ (LE::toUInt32(data) * xxHash64Primes[0]), 23) * xxHash64Primes[1] + xxHash64Primes[2];
+        data += 4;
+        size -= 4;
+    }
+    for (; size; ++data, --size) {
+        hash = xxHash64RotateLeft(hash ^ (static_cast<std::uint8_t>(*data) * xxHash64Primes[4]), 11) * xxHash64Primes[0];
+    }
+
+    // avalanche
+    hash ^= hash >> 33;
+    hash *= xxHash64Primes[1];
+    hash ^= hash >> 29;
+    hash *= xxHash64Primes[2];
+    hash ^= hash >> 32;
+    return hash;
+}
+
+} // namespace CppUtilities
@@ -0,0 +1,213 @@
+#ifndef IOUTILITIES_CHECKSUM_H
+#define IOUTILITIES_CHECKSUM_H
+
+#include "./crc32.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+namespace CppUtilities {
+
+class CPP_UTILITIES_EXPORT Crc32c {
+public:
+    Crc32c();
+
+    void reset();
+    void update(const char *data, std::size_t size);
+    void update(std::string_view data);
+    std::uint32_t finalize() const;
+    static std::uint32_t compute(const char *data, std::size_t size);
+    static std::uint32_t compute(std::string_view data);
+
+private:
+    Crc32 m_crc;
+};
+
+/*!
+ * \brief Constructs a new engine for computing the CRC-32C.
+ */
+inline Crc32c::Crc32c()
+    : m_crc(Crc32::Variant::Castagnoli)
+{
+}
+
+/*!
+ * \brief Resets the state so a new checksum can be computed.
+ */
+inline void Crc32c::reset()
+{
+    m_crc.reset();
+}
+
+/*!
+ * \brief Updates the checksum with the specified \a data.
+ */
+inline void Crc32c::update(const char *data, std::size_t size)
+{
+    m_crc.update(data, size);
+}
+
+/*!
+ * \brief Updates the checksum with the specified \a data.
+ */
+inline void Crc32c::update(std::string_view data)
+{
+    m_crc.update(data.data(), data.size());
+}
+
+/*!
+ * \brief Returns the checksum of the data passed to update() so far.
+ */
+inline std::uint32_t Crc32c::finalize() const
+{
+    return m_crc.finalize();
+}
+
+/*!
+ * \brief Computes the checksum of the specified \a data in one go.
+ */
+inline std::uint32_t Crc32c::compute(const char *data, std::size_t size)
+{
+    return Crc32::compute(data, size, Crc32::Variant::Castagnoli);
+}
+
+/*!
+ * \brief Computes the checksum of the specified \a data in one go.
+ */
+inline std::uint32_t Crc32c::compute(std::string_view data)
+{
+    return Crc32::compute(data.data(), data.size(), Crc32::Variant::Castagnoli);
+}
+
+class CPP_UTILITIES_EXPORT Adler32 {
+public:
+    Adler32();
+
+    void reset();
+    void update(const char *data, std::size_t size);
+    void update(std::string_view data);
+    std::uint32_t finalize() const;
+    static std::uint32_t compute(const char *data, std::size_t size);
+    static std::uint32_t compute(std::string_view data);
+
+private:
+    std::uint32_t m_state;
+};
+
+/*!
+ * \brief Constructs a new engine for computing the Adler-32 checksum.
+ */
+inline Adler32::Adler32()
+    : m_state(1)
+{
+}
+
+/*!
+ * \brief Resets the state so a new checksum can be computed.
+ */
+inline void Adler32::reset()
+{
+    m_state = 1;
+}
+
+/*!
+ * \brief Updates the checksum with the specified \a data.
+ */
+inline void Adler32::update(std::string_view data)
+{
+    update(data.data(), data.size());
+}
+
+/*!
+ * \brief Returns the checksum of the data passed to update() so far.
+ */
+inline std::uint32_t Adler32::finalize() const
+{
+    return m_state;
+}
+
+/*!
+ * \brief Computes the checksum of the specified \a data in one go.
+ */
+inline std::uint32_t Adler32::compute(const char *data, std::size_t size)
+{
+    auto adler = Adler32();
+    adler.update(data, size);
+    return adler.finalize();
+}
+
+/*!
+ * \brief Computes the checksum of the specified \a data in one go.
+ */
+inline std::uint32_t Adler32::compute(std::string_view data)
+{
+    return compute(data.data(), data.size());
+}
+
+class CPP_UTILITIES_EXPORT XxHash64 {
+public:
+    explicit XxHash64(std::uint64_t seed = 0);
+
+    std::uint64_t seed() const;
+    void reset();
+    void update(const char *data, std::size_t size);
+    void update(std::string_view data);
+    std::uint64_t finalize() const;
+    static std::uint64_t compute(const char *data, std::size_t size, std::uint64_t seed = 0);
+    static std::uint64_t compute(std::string_view data, std::uint64_t seed = 0);
+
+private:
+    std::uint64_t m_seed;
+    std::uint64_t m_accumulators[4];
+    std::uint64_t m_totalSize;
+    char m_buffer[32];
+    std::size_t m_bufferSize;
+};
+
+/*!
+ * \brief Constructs a new engine for computing the XXH64 hash with the specified \a seed.
+ */
+inline XxHash64::XxHash64(std::uint64_t seed)
+    : m_seed(seed)
+{
+    reset();
+}
+
+/*!
+ * \brief Returns the seed the hash is computed with.
+ */
+inline std::uint64_t XxHash64::seed() const
+{
+    return m_seed;
+}
+
+/*!
+ * \brief Updates the hash with the specified \a data.
+ */
+inline void XxHash64::update(std::string_view data)
+{
+    update(data.data(), data.size());
+}
+
+/*!
+ * \brief Computes the hash of the specified \a data in one go.
+ */
+inline std::uint64_t XxHash64::compute(const char *data, std::size_t size, std::uint64_t seed)
+{
+    auto hash = XxHash64(seed);
+    hash.update(data, size);
+    return hash.finalize();
+}
+
+/*!
+ * \brief Computes the hash of the specified \a data in one go.
+ */
+inline std::uint64_t XxHash64::compute(std::string_view data, std::uint64_t seed)
+{
+    return compute(data.data(), data.size(), seed);
+}
+
+} // namespace CppUtilities
+
+#endif // IOUTILITIES_CHECKSUM_H
@@ -0,0 +1,305 @@
+#include "./crc32.h"
+
+#include "../misc/cpufeaturesprivate.h"
+
+#include <cstring>
+
+namespace CppUtilities {
+
+/*!
+ * \class Crc32
+ * \brief Computes CRC-32 checksums incrementally.
+ *
+ * The checksum is updated via update() as data becomes available and obtained via finalize(). The engine processes
+ * 16 bytes per iteration using "slicing-by-16" tables. On x86 CPUs supporting PCLMULQDQ, bigger blocks are
+ * folded via carry-less multiplication instead which is selected at runtime. The Castagnoli variant is computed
+ * via the crc32 instruction on x86 CPUs supporting SSE4.2.
+ *
+ * Besides the (non-reflected) variant used by Ogg and BinaryReader::computeCrc32() other common variants are
+ * supported, see Crc32::Variant.
+ *
+ * \remarks finalize() does not alter the state so it is possible to continue updating the checksum afterwards.
+ */
+
+/// \cond
+namespace Detail {
+
+/*!
+ * \brief Returns \a value with the order of its bits reversed.
+ */
+constexpr std::uint32_t crc32ReflectBits(std::uint32_t value)
+{
+    auto reflected = std::uint32_t();
+    for (auto bit = 0; bit != 32; ++bit, value >>= 1) {
+        reflected = (reflected << 1) | (value & 1);
+    }
+    return reflected;
+}
+
+/*!
+ * \brief Returns x^\a exponent modulo the specified \a polynomial (not reflected, x^32 implied).
+ */
+constexpr std::uint32_t crc32PowerModulo(std::uint32_t polynomial, unsigned int exponent)
+{
+    auto remainder = std::uint32_t(1);
+    for (; exponent; --exponent) {
+        remainder = (remainder & 0x80000000u) ? ((remainder << 1) ^ polynomial) : (remainder << 1);
+    }
+    return remainder;
+}
+
+/*!
+ * \brief Contains the tables for computing the CRC-32 with the specified \a polynomial using "slicing-by-16".
+ * \remarks The table with index n contains the CRC of each byte value followed by n zero bytes.
+ */
+template <std::uint32_t polynomial, bool reflected> struct Crc32Tables {
+    constexpr Crc32Tables()
+        : values()
+    {
+        for (std::uint32_t byte = 0; byte != 256; ++byte) {
+            auto crc = reflected ? byte : byte << 24;
+            for (auto bit = 0; bit != 8; ++bit) {
+                if constexpr (reflected) {
+                    crc = (crc & 1) ? ((crc >> 1) ^ crc32ReflectBits(polynomial)) : (crc >> 1);
+                } else {
+                    crc = (crc & 0x80000000u) ? ((crc << 1) ^ polynomial) : (crc << 1);
+                }
+            }
+            values[0][byte] = crc;
+        }
+        for (std::size_t table = 1; table != 16; ++table) {
+            for (std::size_t byte = 0; byte != 256; ++byte) {
+                const auto previous = values[table - 1][byte];
+                values[table][byte] = reflected ? ((previous >> 8) ^ values[0][previous & 0xFF]) : ((previous << 8) ^ values[0][previous >> 24]);
+            }
+        }
+    }
+    std::uint32_t values[16][256];
+};
+
+/*!
+ * \brief Updates the specified \a crc register processing 16 bytes per iteration.
+ */
+template <std::uint32_t polynomial, bool reflected> std::uint32_t crc32UpdateSlicingBy16(std::uint32_t crc, const char *data, std::size_t size)
+{
+    static constexpr auto tables = Crc32Tables<polynomial, reflected>();
+    const auto &t = tables.values;
+    const auto *bytes = reinterpret_cast<const std::uint8_t *>(data);
+    for (; size >= 16; size -= 16, bytes += 16) {
+        // the register is XOR-ed with the first 4 bytes of the block (in the bit order of the variant)
+        if constexpr (reflected) {
+            crc = t[15][(crc & 0xFF) ^ bytes[0]] ^ t[14][((crc >> 8) & 0xFF) ^ bytes[1]] ^ t[13][((crc >> 16) & 0xFF) ^ bytes[2]]
+                ^ t[12][(crc >> 24) ^ bytes[3]];
+        } else {
+            crc = t[15][(crc >> 24) ^ bytes[0]] ^ t[14][((crc >> 16) & 0xFF) ^ bytes[1]] ^ t[13][((crc >> 8) & 0xFF) ^ bytes[2]]
+                ^ t[12][(crc & 0xFF) ^ bytes[3]];
+        }
+        crc ^= t[11][bytes[4]] ^ t[10][bytes[5]] ^ t[9][bytes[6]] ^ t[8][bytes[7]] ^ t[7][bytes[8]] ^ t[6][bytes[9]] ^ t[5][bytes[10]]
+            ^ t[4][bytes[11]] ^ t[3][bytes[12]] ^ t[2][bytes[13]] ^ t[1][bytes[14]] ^ t[0][bytes[15]];
+    }
+    for (const auto *const end = bytes + size; bytes != end; ++bytes) {
+        if constexpr (reflected) {
+            crc = (crc >> 8) ^ t[0][(crc & 0xFF) ^ *bytes];
+        } else {
+            crc = (crc << 8) ^ t[0][(crc >> 24) ^ *bytes];
+        }
+    }
+    return crc;
+}
+
+#ifdef CPP_UTILITIES_X86_DISPATCH
+/*!
+ * \brief Returns the 64-bit operand for multiplying with x^\a exponent modulo the \a polynomial via PCLMULQDQ.
+ * \remarks
+ * - In the reflected case the bits are mirrored and the carry-less product of two reflected operands ends up
+ *   being multiplied by x. Hence the constant for x^(exponent - 1) is used.
+ * - Only congruence modulo the polynomial matters so the 32-bit remainder is used rather than a 33-bit constant.
+ */
+template <std::uint32_t polynomial, bool reflected> constexpr std::uint64_t crc32FoldingOperand(unsigned int exponent)
+{
+    if constexpr (reflected) {
+        return static_cast<std::uint64_t>(crc32ReflectBits(crc32PowerModulo(polynomial, exponent - 1))) << 32;
+    } else {
+        return crc32PowerModulo(polynomial, exponent);
+    }
+}
+
+/*!
+ * \brief Returns the constants for folding a 128-bit register forward by the specified \a distance in bits.
+ */
+template <std::uint32_t polynomial, bool reflected, unsigned int distance> CPP_UTILITIES_TARGET("pclmul,ssse3") inline __m128i crc32FoldingConstants()
+{
+    // the earlier 64 bits of the register need to be multiplied by x^(distance + 64), the later ones by x^distance
+    constexpr auto earlier = static_cast<long long>(crc32FoldingOperand<polynomial, reflected>(distance + 64));
+    constexpr auto later = static_cast<long long>(crc32FoldingOperand<polynomial, reflected>(distance));
+    // the earlier bytes are in the low half when reflected and in the high half (after reversing the byte order) otherwise
+    return reflected ? _mm_set_epi64x(later, earlier) : _mm_set_epi64x(earlier, later);
+}
+
+CPP_UTILITIES_TARGET("pclmul,ssse3") inline __m128i crc32Fold(__m128i value, __m128i constants, __m128i next)
+{
+    return _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(value, constants, 0x00), _mm_clmulepi64_si128(value, constants, 0x11)), next);
+}
+
+/*!
+ * \brief Loads a 16-byte block reversing its byte order in the non-reflected case.
+ */
+template <bool reflected> CPP_UTILITIES_TARGET("pclmul,ssse3") inline __m128i crc32Load(__m128i reverseMask, const char *block)
+{
+    const auto value = _mm_loadu_si128(reinterpret_cast<const __m128i *>(block));
+    return reflected ? value : _mm_shuffle_epi8(value, reverseMask);
+}
+
+/*!
+ * \brief Updates the specified \a crc register by folding 64 bytes per iteration via carry-less multiplication.
+ * \remarks
+ * - The register is XOR-ed into the first block so subsequent blocks are processed with an initial value of zero.
+ *   The folded 128-bit remainder is congruent to all data processed so far and is eventually reduced by passing it
+ *   through the table-based implementation (followed by the remaining bytes).
+ * - For the non-reflected case the byte order of each block is reversed so the polynomial's degrees match the bit
+ *   positions of the register.
+ */
+template <std::uint32_t polynomial, bool reflected>
+CPP_UTILITIES_TARGET("pclmul,ssse3")
+std::uint32_t crc32UpdatePclmul(std::uint32_t crc, const char *data, std::size_t size)
+{
+    const auto reverseMask = _mm_setr_epi8(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0);
+    auto x0 = crc32Load<reflected>(reverseMask, data), x1 = crc32Load<reflected>(reverseMask, data + 16);
+    auto x2 = crc32Load<reflected>(reverseMask, data + 32), x3 = crc32Load<reflected>(reverseMask, data + 48);
+    x0 = _mm_xor_si128(x0, reflected ? _mm_cvtsi32_si128(static_cast<int>(crc)) : _mm_set_epi32(static_cast<int>(crc), 0, 0, 0));
+    data += 64;
+    size -= 64;
+
+    // fold four registers in parallel
+    const auto by512 = crc32FoldingConstants<polynomial, reflected, 512>();
+    for (; size >= 64; data += 64, size -= 64) {
+        x0 = crc32Fold(x0, by512, crc32Load<reflected>(reverseMask, data));
+        x1 = crc32Fold(x1, by512, crc32Load<reflected>(reverseMask, data + 16));
+        x2 = crc32Fold(x2, by512, crc32Load<reflected>(reverseMask, data + 32));
+        x3 = crc32Fold(x3, by512, crc32Load<reflected>(reverseMask, data + 48));
+    }
+
+    // fold them into one register and continue with single blocks
+    const auto by128 = crc32FoldingConstants<polynomial, reflected, 128>();
+    x3 = crc32Fold(crc32Fold(crc32Fold(x0, by128, x1), by128, x2), by128, x3);
+    for (; size >= 16; data += 16, size -= 16) {
+        x3 = crc32Fold(x3, by128, crc32Load<reflected>(reverseMask, data));
+    }
+
+    // reduce the remainder and the remaining bytes via tables
+    alignas(16) char remainder[16];
+    _mm_store_si128(reinterpret_cast<__m128i *>(remainder), reflected ? x3 : _mm_shuffle_epi8(x3, reverseMask));
+    crc = crc32UpdateSlicingBy16<polynomial, reflected>(0, remainder, sizeof(remainder));
+    return crc32UpdateSlicingBy16<polynomial, reflected>(crc, data, size);
+}
+
+/*!
+ * \brief Updates the specified \a crc register of the Castagnoli variant using the crc32 instruction.
+ */
+CPP_UTILITIES_TARGET("sse4.2") std::uint32_t crc32UpdateSse42(std::uint32_t crc, const char *data, std::size_t size)
+{
+#ifdef __x86_64__
+    auto crc64 = static_cast<std::uint64_t>(crc);
+    for (; size >= 8; data += 8, size -= 8) {
+        auto value = std::uint64_t();
+        std::memcpy(&value, data, sizeof(value));
+        crc64 = _mm_crc32_u64(crc64, value);
+    }
+    crc = static_cast<std::uint32_t>(crc64);
+#endif
+    for (; size >= 4; data += 4, size -= 4) {
+        auto value = std::uint32_t();
+        std::memcpy(&value, data, sizeof(value));
+        crc = _mm_crc32_u32(crc, value);
+    }
+    for (; size; ++data, --size) {
+        crc = _mm_crc32_u8(crc, static_cast<std::uint8_t>(*data));
+    }
+    return crc;
+}
+#endif
+
+/*!
+ * \brief Updates the specified \a crc register using the best implementation the CPU supports.
+ */
+template <std::uint32_t polynomial, bool reflected> std::uint32_t crc32Update(std::uint32_t crc, const char *data, std::size_t size)
+{
+#ifdef CPP_UTILITIES_X86_DISPATCH
+    if (size >= 64 && CpuFeatures::hasPclmul() && CpuFeatures::hasSsse3()) {
+        return crc32UpdatePclmul<polynomial, reflected>(crc, data, size);
+    }
+#endif
+    return crc32UpdateSlicingBy16<polynomial, reflected>(crc, data, size);
+}
+
+/*!
+ * \brief Returns the initial value of the register for the specified \a variant.
+ */
+constexpr std::uint32_t crc32InitialValue(Crc32::Variant variant)
+{
+    return variant == Crc32::Variant::Ogg ? 0x00000000u : 0xFFFFFFFFu;
+}
+
+/*!
+ * \brief Returns the value the register is XOR-ed with when finalizing the checksum for the specified \a variant.
+ */
+constexpr std::uint32_t crc32FinalXor(Crc32::Variant variant)
+{
+    return variant == Crc32::Variant::Ogg || variant == Crc32::Variant::Mpeg2 ? 0x00000000u : 0xFFFFFFFFu;
+}
+
+} // namespace Detail
+/// \endcond
+
+/*!
+ * \brief Constructs a new engine for computing the specified \a variant of the CRC-32.
+ */
+Crc32::Crc32(Variant variant)
+    : m_state(Detail::crc32InitialValue(variant))
+    , m_variant(variant)
+{
+}
+
+/*!
+ * \brief Resets the state so a new checksum can be computed.
+ */
+void Crc32::reset()
+{
+    m_state = Detail::crc32InitialValue(m_variant);
+}
+
+/*!
+ * \brief Updates the checksum with the specified \a data.
+ */
+void Crc32::update(const char *data, std::size_t size)
+{
+    switch (m_variant) {
+    case Variant::Ogg:
+    case Variant::Mpeg2:
+    case Variant::Bzip2:
+        m_state = Detail::crc32Update<0x04C11DB7u, false>(m_state, data, size);
+        break;
+    case Variant::IsoHdlc:
+        m_state = Detail::crc32Update<0x04C11DB7u, true>(m_state, data, size);
+        break;
+    case Variant::Castagnoli:
+#ifdef CPP_UTILITIES_X86_DISPATCH
+        if (CpuFeatures::hasSse42()) {
+            m_state = Detail::crc32UpdateSse42(m_state, data, size);
+            break;
+        }
+#endif
+        m_state = Detail::crc32Update<0x1EDC6F41u, true>(m_state, data, size);
+        break;
+    }
+}
+
+/*!
+ * \brief Returns the checksum of the data passed to update() so far.
+ */
+std::uint32_t Crc32::finalize() const
+{
+    return m_state ^ Detail::crc32FinalXor(m_variant);
+}
+
+} // namespace CppUtilities
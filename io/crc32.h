@@ -0,0 +1,73 @@
+#ifndef IOUTILITIES_CRC32_H
+#define IOUTILITIES_CRC32_H
+
+#include "../global.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+namespace CppUtilities {
+
+class CPP_UTILITIES_EXPORT Crc32 {
+public:
+    enum class Variant {
+        Ogg, /**< polynomial 0x04C11DB7, not reflected, initial value 0, no final XOR (used by Ogg and BinaryReader::computeCrc32()) */
+        Mpeg2, /**< polynomial 0x04C11DB7, not reflected, initial value 0xFFFFFFFF, no final XOR (used by MPEG-2 transport streams) */
+        Bzip2, /**< polynomial 0x04C11DB7, not reflected, initial value 0xFFFFFFFF, final XOR 0xFFFFFFFF (used by bzip2 and AAL5) */
+        IsoHdlc, /**< polynomial 0x04C11DB7, reflected, initial value 0xFFFFFFFF, final XOR 0xFFFFFFFF (used by zlib, PNG and Ethernet) */
+        Castagnoli, /**< polynomial 0x1EDC6F41, reflected, initial value 0xFFFFFFFF, final XOR 0xFFFFFFFF (used by iSCSI, ext4 and Btrfs) */
+    };
+
+    explicit Crc32(Variant variant = Variant::Ogg);
+
+    Variant variant() const;
+    void reset();
+    void update(const char *data, std::size_t size);
+    void update(std::string_view data);
+    std::uint32_t finalize() const;
+    static std::uint32_t compute(const char *data, std::size_t size, Variant variant = Variant::Ogg);
+    static std::uint32_t compute(std::string_view data, Variant variant = Variant::Ogg);
+
+private:
+    std::uint32_t m_state;
+    Variant m_variant;
+};
+
+/*!
+ * \brief Returns the variant of the CRC-32 which is computed.
+ */
+inline Crc32::Variant Crc32::variant() const
+{
+    return m_variant;
+}
+
+/*!
+ * \brief Updates the checksum with the specified \a data.
+ */
+inline void Crc32::update(std::string_view data)
+{
+    update(data.data(), data.size());
+}
+
+/*!
+ * \brief Computes the checksum of the specified \a data in one go.
+ */
+inline std::uint32_t Crc32::compute(const char *data, std::size_t size, Variant variant)
+{
+    auto crc = Crc32(variant);
+    crc.update(data, size);
+    return crc.finalize();
+}
+
+/*!
+ * \brief Computes the checksum of the specified \a data in one go.
+ */
+inline std::uint32_t Crc32::compute(std::string_view data, Variant variant)
+{
+    return compute(data.data(), data.size(), variant);
+}
+
+} // namespace CppUtilities
+
+#endif // IOUTILITIES_CRC32_H
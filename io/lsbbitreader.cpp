@@ -0,0 +1,21 @@
+#include "./lsbbitreader.h"
+
+namespace CppUtilities {
+
+/*!
+ * \class LsbBitReader
+ * \brief The LsbBitReader class provides bitwise reading of buffered data packed least significant bit first.
+ *
+ * This is the bit order used by DEFLATE and similar formats. The API and the 64-bit cache (implemented by
+ * Detail::BasicBitReader) work like within BitReader except that the cache is refilled via a single unaligned little
+ * endian load and bits are taken from its least significant end.
+ *
+ * Example (reading the header of a DEFLATE block):
+ * ```
+ * auto reader = LsbBitReader(data, size);
+ * const auto isFinal = reader.readBit();
+ * const auto type = reader.readBits<std::uint8_t>(2);
+ * ```
+ */
+
+} // namespace CppUtilities
@@ -0,0 +1,38 @@
+#ifndef IOUTILITIES_LSBBITREADER_H
+#define IOUTILITIES_LSBBITREADER_H
+
+#include "./basicbitreader.h"
+
+#include <cstdint>
+
+namespace CppUtilities {
+
+class CPP_UTILITIES_EXPORT LsbBitReader : public Detail::BasicBitReader<LsbBitReader, Detail::BitOrder::LsbFirst> {
+public:
+    LsbBitReader(const char *buffer, std::size_t bufferSize);
+    LsbBitReader(const char *buffer, const char *end);
+};
+
+/*!
+ * \brief Constructs a new LsbBitReader.
+ * \remarks Does not take ownership over the specified \a buffer.
+ */
+inline LsbBitReader::LsbBitReader(const char *buffer, std::size_t bufferSize)
+    : LsbBitReader(buffer, buffer + bufferSize)
+{
+}
+
+/*!
+ * \brief Constructs a new LsbBitReader.
+ * \remarks
+ *  - Does not take ownership over the specified \a buffer.
+ *  - \a end must not be less than \a buffer.
+ */
+inline LsbBitReader::LsbBitReader(const char *buffer, const char *end)
+    : BasicBitReader(buffer, end)
+{
+}
+
+} // namespace CppUtilities
+
+#endif // IOUTILITIES_LSBBITREADER_H
@@ -0,0 +1,236 @@
+#include "./mappedfile.h"
+
+#include <algorithm>
+#include <ios>
+#include <limits>
+#include <system_error>
+
+#if defined(PLATFORM_WINDOWS)
+#include "../conversion/stringconversion.h"
+#include <fcntl.h>
+#include <io.h>
+#include <sys/stat.h>
+#include <windows.h>
+#elif defined(PLATFORM_UNIX)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+using namespace std;
+
+namespace CppUtilities {
+
+/*!
+ * \class MappedFile
+ * \brief Maps a file read-only into memory.
+ *
+ * This allows reading (large) files without copying the data through a stream buffer. The mapping can be accessed
+ * as view of bytes via view() or parsed via the BufferReader returned by reader(). Only the pages which are actually
+ * accessed are read from disk (by the page cache of the operating system). To help the operating system, an
+ * AccessPattern can be specified when opening the file or later via advise().
+ *
+ * \remarks
+ * - Mapping is implemented via mmap()/madvise() under UNIX and via CreateFileMapping()/MapViewOfFile() under Windows.
+ * - The mapping remains valid if the file descriptor/path it has been created from is closed/removed. However, truncating
+ *   the file while it is mapped leads to SIGBUS under UNIX when accessing the truncated pages.
+ * \sa BufferReader
+ */
+
+/*!
+ * \brief Unmaps the currently mapped file (if any) and takes over the mapping from \a other.
+ */
+MappedFile &MappedFile::operator=(MappedFile &&other)
+{
+    if (this != &other) {
+        close();
+        m_data = other.m_data;
+        m_size = other.m_size;
+        m_isOpen = other.m_isOpen;
+        other.m_data = nullptr;
+        other.m_size = 0;
+        other.m_isOpen = false;
+    }
+    return *this;
+}
+
+/*!
+ * \brief Maps the file at the specified (UTF-8 encoded) \a path unmapping any previously mapped file.
+ * \throws Throws std::ios_base::failure if the file can not be opened or mapped.
+ */
+void MappedFile::open(const std::string &path, AccessPattern accessPattern)
+{
+#if defined(PLATFORM_WINDOWS)
+    auto ec = std::error_code();
+    const auto widePath = convertMultiByteToWide(ec, path);
+    if (!widePath.first) {
+        throw std::ios_base::failure("converting path to UTF-16", ec);
+    }
+    const auto fileDescriptor = _wopen(widePath.first.get(), _O_RDONLY | _O_BINARY);
+    if (fileDescriptor == -1) {
+        throw std::ios_base::failure("_wopen failed", std::error_code(errno, std::system_category()));
+    }
+#elif defined(PLATFORM_UNIX)
+    const auto fileDescriptor = ::open(path.data(), O_RDONLY | O_CLOEXEC);
+    if (fileDescriptor == -1) {
+        throw std::ios_base::failure("open failed", std::error_code(errno, std::system_category()));
+    }
+#else
+    throw std::ios_base::failure("mapping files is not supported on this platform");
+#endif
+#if defined(PLATFORM_WINDOWS) || defined(PLATFORM_UNIX)
+    try {
+        open(fileDescriptor, accessPattern);
+    } catch (...) {
+#ifdef PLATFORM_WINDOWS
+        _close(fileDescriptor);
+#else
+        ::close(fileDescriptor);
+#endif
+        throw;
+    }
+    // the mapping does not need the file descriptor to stay open
+#ifdef PLATFORM_WINDOWS
+    _close(fileDescriptor);
+#else
+    ::close(fileDescriptor);
+#endif
+#endif
+}
+
+/*!
+ * \brief Maps the file the specified \a fileDescriptor refers to unmapping any previously mapped file.
+ * \remarks Does not take ownership over \a fileDescriptor. So it can e.g. be obtained from NativeFileStream::fileDescriptor().
+ * \throws Throws std::ios_base::failure if the file can not be mapped.
+ */
+void MappedFile::open(int fileDescriptor, AccessPattern accessPattern)
+{
+    close();
+    map(fileDescriptor, accessPattern);
+}
+
+/*!
+ * \brief Unmaps the currently mapped file (if any).
+ */
+void MappedFile::close()
+{
+    if (m_data) {
+#if defined(PLATFORM_WINDOWS)
+        UnmapViewOfFile(m_data);
+#elif defined(PLATFORM_UNIX)
+        munmap(const_cast<char *>(m_data), m_size);
+#endif
+    }
+    m_data = nullptr;
+    m_size = 0;
+    m_isOpen = false;
+}
+
+/*!
+ * \brief Gives the operating system a hint how the specified range of the mapping is going to be accessed.
+ * \remarks
+ * - The range is clamped to the size of the mapping.
+ * - The hint is ignored on platforms not supporting it. Errors are ignored as well because this is only a hint.
+ */
+void MappedFile::advise(AccessPattern accessPattern, std::size_t offset, std::size_t length)
+{
+    if (!m_data || offset >= m_size) {
+        return;
+    }
+    length = std::min(length, m_size - offset);
+#if defined(PLATFORM_UNIX)
+    // madvise() requires the address to be page-aligned
+    static const auto pageSize = static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+    const auto alignedOffset = offset - (offset % pageSize);
+    length += offset - alignedOffset;
+    auto advice = MADV_NORMAL;
+    switch (accessPattern) {
+    case AccessPattern::Normal:
+        break;
+    case AccessPattern::Sequential:
+        advice = MADV_SEQUENTIAL;
+        break;
+    case AccessPattern::Random:
+        advice = MADV_RANDOM;
+        break;
+    case AccessPattern::WillNeed:
+        advice = MADV_WILLNEED;
+        break;
+    }
+    madvise(const_cast<char *>(m_data) + alignedOffset, length, advice);
+#elif defined(PLATFORM_WINDOWS) && defined(_WIN32_WINNT) && _WIN32_WINNT >= 0x0602
+    if (accessPattern == AccessPattern::WillNeed) {
+        auto range = WIN32_MEMORY_RANGE_ENTRY{ const_cast<char *>(m_data) + offset, length };
+        PrefetchVirtualMemory(GetCurrentProcess(), 1, &range, 0);
+    }
+#else
+    CPP_UTILITIES_UNUSED(accessPattern)
+#endif
+}
+
+/*!
+ * \brief Maps the file the specified \a fileDescriptor refers to.
+ */
+void MappedFile::map(int fileDescriptor, AccessPattern accessPattern)
+{
+#if defined(PLATFORM_WINDOWS)
+    struct _stat64 fileInfo;
+    if (_fstat64(fileDescriptor, &fileInfo) == -1) {
+        throw std::ios_base::failure("_fstat64 failed", std::error_code(errno, std::system_category()));
+    }
+    if (static_cast<std::uint64_t>(fileInfo.st_size) > numeric_limits<std::size_t>::max()) {
+        throw std::ios_base::failure("file exceeds address space");
+    }
+    m_size = static_cast<std::size_t>(fileInfo.st_size);
+    m_isOpen = true;
+    if (!m_size) {
+        return; // mapping an empty file is not possible but also not required
+    }
+    const auto fileHandle = reinterpret_cast<HANDLE>(_get_osfhandle(fileDescriptor));
+    const auto mappingHandle = CreateFileMappingW(fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (!mappingHandle) {
+        m_size = 0;
+        m_isOpen = false;
+        throw std::ios_base::failure("CreateFileMappingW failed", std::error_code(static_cast<int>(GetLastError()), std::system_category()));
+    }
+    m_data = static_cast<const char *>(MapViewOfFile(mappingHandle, FILE_MAP_READ, 0, 0, m_size));
+    const auto error = GetLastError();
+    CloseHandle(mappingHandle); // the view keeps the mapping alive
+    if (!m_data) {
+        m_size = 0;
+        m_isOpen = false;
+        throw std::ios_base::failure("MapViewOfFile failed", std::error_code(static_cast<int>(error), std::system_category()));
+    }
+    advise(accessPattern);
+#elif defined(PLATFORM_UNIX)
+    struct stat fileInfo;
+    if (fstat(fileDescriptor, &fileInfo) == -1) {
+        throw std::ios_base::failure("fstat failed", std::error_code(errno, std::system_category()));
+    }
+    if (static_cast<std::uint64_t>(fileInfo.st_size) > numeric_limits<std::size_t>::max()) {
+        throw std::ios_base::failure("file exceeds address space");
+    }
+    m_size = static_cast<std::size_t>(fileInfo.st_size);
+    m_isOpen = true;
+    if (!m_size) {
+        return; // mapping an empty file is not possible but also not required
+    }
+    const auto data = mmap(nullptr, m_size, PROT_READ, MAP_SHARED, fileDescriptor, 0);
+    if (data == MAP_FAILED) {
+        m_size = 0;
+        m_isOpen = false;
+        throw std::ios_base::failure("mmap failed", std::error_code(errno, std::system_category()));
+    }
+    m_data = static_cast<const char *>(data);
+    if (accessPattern != AccessPattern::Normal) {
+        advise(accessPattern);
+    }
+#else
+    CPP_UTILITIES_UNUSED(fileDescriptor)
+    CPP_UTILITIES_UNUSED(accessPattern)
+    throw std::ios_base::failure("mapping files is not supported on this platform");
+#endif
+}
+
+} // namespace CppUtilities
@@ -0,0 +1,144 @@
+#ifndef IOUTILITIES_MAPPEDFILE_H
+#define IOUTILITIES_MAPPEDFILE_H
+
+#include "./bufferreader.h"
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace CppUtilities {
+
+class CPP_UTILITIES_EXPORT MappedFile {
+public:
+    enum class AccessPattern {
+        Normal, /**< no particular access pattern is expected */
+        Sequential, /**< the file is expected to be read sequentially so aggressive read-ahead is beneficial */
+        Random, /**< the file is expected to be accessed at random offsets so read-ahead is pointless */
+        WillNeed, /**< the whole file is expected to be needed soon so it should be read in advance */
+    };
+
+    MappedFile();
+    explicit MappedFile(const std::string &path, AccessPattern accessPattern = AccessPattern::Normal);
+    explicit MappedFile(int fileDescriptor, AccessPattern accessPattern = AccessPattern::Normal);
+    MappedFile(const MappedFile &) = delete;
+    MappedFile(MappedFile &&other);
+    MappedFile &operator=(const MappedFile &) = delete;
+    MappedFile &operator=(MappedFile &&other);
+    ~MappedFile();
+
+    bool isOpen() const;
+    void open(const std::string &path, AccessPattern accessPattern = AccessPattern::Normal);
+    void open(int fileDescriptor, AccessPattern accessPattern = AccessPattern::Normal);
+    void close();
+    void advise(AccessPattern accessPattern, std::size_t offset = 0, std::size_t length = std::string_view::npos);
+    const char *data() const;
+    std::size_t size() const;
+    std::string_view view() const;
+    BufferReader reader() const;
+
+private:
+    void map(int fileDescriptor, AccessPattern accessPattern);
+
+    const char *m_data;
+    std::size_t m_size;
+    bool m_isOpen;
+};
+
+/*!
+ * \brief Constructs a MappedFile which does not map any file yet.
+ */
+inline MappedFile::MappedFile()
+    : m_data(nullptr)
+    , m_size(0)
+    , m_isOpen(false)
+{
+}
+
+/*!
+ * \brief Constructs a MappedFile and maps the file at the specified (UTF-8 encoded) \a path.
+ * \throws Throws std::ios_base::failure if the file can not be opened or mapped.
+ */
+inline MappedFile::MappedFile(const std::string &path, AccessPattern accessPattern)
+    : MappedFile()
+{
+    open(path, accessPattern);
+}
+
+/*!
+ * \brief Constructs a MappedFile and maps the file the specified \a fileDescriptor refers to.
+ * \remarks Does not take ownership over \a fileDescriptor.
+ * \throws Throws std::ios_base::failure if the file can not be mapped.
+ */
+inline MappedFile::MappedFile(int fileDescriptor, AccessPattern accessPattern)
+    : MappedFile()
+{
+    open(fileDescriptor, accessPattern);
+}
+
+/*!
+ * \brief Moves the mapping from \a other to a new MappedFile.
+ */
+inline MappedFile::MappedFile(MappedFile &&other)
+    : m_data(other.m_data)
+    , m_size(other.m_size)
+    , m_isOpen(other.m_isOpen)
+{
+    other.m_data = nullptr;
+    other.m_size = 0;
+    other.m_isOpen = false;
+}
+
+/*!
+ * \brief Unmaps the file if one is mapped.
+ */
+inline MappedFile::~MappedFile()
+{
+    close();
+}
+
+/*!
+ * \brief Returns whether a file is mapped.
+ * \remarks A mapped empty file counts as open although data() returns nullptr in this case.
+ */
+inline bool MappedFile::isOpen() const
+{
+    return m_isOpen;
+}
+
+/*!
+ * \brief Returns the begin of the mapping.
+ */
+inline const char *MappedFile::data() const
+{
+    return m_data;
+}
+
+/*!
+ * \brief Returns the size of the mapping which is the size of the file at the time it has been mapped.
+ */
+inline std::size_t MappedFile::size() const
+{
+    return m_size;
+}
+
+/*!
+ * \brief Returns the mapping as view of bytes.
+ */
+inline std::string_view MappedFile::view() const
+{
+    return std::string_view(m_data, m_size);
+}
+
+/*!
+ * \brief Returns a BufferReader for reading primitive data types directly from the mapping.
+ * \remarks The reader is only valid as long as the file is mapped.
+ */
+inline BufferReader MappedFile::reader() const
+{
+    return BufferReader(m_data, m_size);
+}
+
+} // namespace CppUtilities
+
+#endif // IOUTILITIES_MAPPEDFILE_H
@@ -0,0 +1,328 @@
+#include "./readaheadbuffer.h"
+#include "./readatprivate.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <ios>
+
+#if defined(PLATFORM_WINDOWS)
+#include "../conversion/stringconversion.h"
+#include <fcntl.h>
+#include <io.h>
+#include <sys/stat.h>
+#elif defined(PLATFORM_UNIX)
+#include <fcntl.h>
+#include <sys/stat.h>
+#endif
+
+using namespace std;
+
+namespace CppUtilities {
+
+/*!
+ * \class ReadAheadBuffer
+ * \brief The ReadAheadBuffer class is a read-only stream buffer which reads a file ahead of the current position
+ *        in a background thread.
+ *
+ * A background thread keeps bufferCount() buffers of bufferSize() bytes filled ahead of the current position so
+ * reading from the file (e.g. waiting for a slow disk or network file system) overlaps with parsing the data. This is
+ * useful when walking through big files sequentially, e.g.:
+ * ```
+ * auto buffer = ReadAheadBuffer(path);
+ * auto stream = std::istream(&buffer);
+ * auto reader = BinaryReader(&stream);
+ * ```
+ *
+ * Seeking within the current buffer or forward into buffers which have already been prefetched keeps the prefetched
+ * data. Seeking elsewhere (e.g. backwards or far forward) throws the prefetched data away and the background thread
+ * continues reading at the new position once data is requested from there. Determining the stream size via
+ * seeking to the end and back (as done by BinaryReader::readStreamsize()) does not discard anything.
+ *
+ * \remarks
+ * - The file is read via pread() under UNIX and via ReadFile() with an explicit offset under Windows so the file
+ *   position of the underlying file descriptor is neither used nor altered.
+ * - The stream buffer must only be accessed by one thread at a time. It can not be used for writing.
+ * - Errors which occur when reading ahead are reported when the erroneous data is requested. The std::istream
+ *   using the buffer will then set the badbit (and rethrow the std::ios_base::failure if enabled).
+ */
+
+/*!
+ * \brief Constructs a ReadAheadBuffer which has not opened a file yet.
+ * \param bufferSize Specifies the size of a single buffer.
+ * \param bufferCount Specifies the number of buffers (at least two are used).
+ */
+ReadAheadBuffer::ReadAheadBuffer(std::size_t bufferSize, std::size_t bufferCount)
+    : m_slots(std::max<std::size_t>(bufferCount, 2))
+    , m_bufferSize(std::max<std::size_t>(bufferSize, 1))
+    , m_head(0)
+    , m_filled(0)
+    , m_prefetchOffset(0)
+    , m_generation(0)
+    , m_endReached(false)
+    , m_stopping(false)
+    , m_getAreaOffset(0)
+    , m_fileSize(0)
+    , m_fileDescriptor(-1)
+    , m_ownsFileDescriptor(false)
+{
+}
+
+/*!
+ * \brief Stops the background thread and closes the file if it has been opened via path.
+ */
+ReadAheadBuffer::~ReadAheadBuffer()
+{
+    close();
+}
+
+/*!
+ * \brief Opens the file at the specified (UTF-8 encoded) \a path closing any previously opened file.
+ * \throws Throws std::ios_base::failure if the file can not be opened.
+ */
+void ReadAheadBuffer::open(const std::string &path)
+{
+    close();
+#if defined(PLATFORM_WINDOWS)
+    auto ec = std::error_code();
+    const auto widePath = convertMultiByteToWide(ec, path);
+    if (!widePath.first) {
+        throw std::ios_base::failure("converting path to UTF-16", ec);
+    }
+    const auto fileDescriptor = _wopen(widePath.first.get(), _O_RDONLY | _O_BINARY);
+    if (fileDescriptor == -1) {
+        throw std::ios_base::failure("_wopen failed", std::error_code(errno, std::system_category()));
+    }
+#elif defined(PLATFORM_UNIX)
+    const auto fileDescriptor = ::open(path.data(), O_RDONLY | O_CLOEXEC);
+    if (fileDescriptor == -1) {
+        throw std::ios_base::failure("open failed", std::error_code(errno, std::system_category()));
+    }
+#else
+    throw std::ios_base::failure("reading ahead is not supported on this platform");
+#endif
+#if defined(PLATFORM_WINDOWS) || defined(PLATFORM_UNIX)
+    try {
+        start(fileDescriptor, true);
+    } catch (...) {
+#ifdef PLATFORM_WINDOWS
+        _close(fileDescriptor);
+#else
+        ::close(fileDescriptor);
+#endif
+        throw;
+    }
+#endif
+}
+
+/*!
+ * \brief Opens the file the specified \a fileDescriptor refers to closing any previously opened file.
+ * \remarks Does not take ownership over \a fileDescriptor. So it can e.g. be obtained from NativeFileStream::fileDescriptor().
+ * \throws Throws std::ios_base::failure if the size of the file can not be determined.
+ */
+void ReadAheadBuffer::open(int fileDescriptor)
+{
+    close();
+    start(fileDescriptor, false);
+}
+
+/*!
+ * \brief Stops the background thread and closes the file if it has been opened via path.
+ * \remarks Does nothing if no file is open.
+ */
+void ReadAheadBuffer::close()
+{
+    if (m_thread.joinable()) {
+        {
+            const auto lock = std::lock_guard(m_mutex);
+            m_stopping = true;
+        }
+        m_condition.notify_all();
+        m_thread.join();
+    }
+    if (m_fileDescriptor != -1 && m_ownsFileDescriptor) {
+#ifdef PLATFORM_WINDOWS
+        _close(m_fileDescriptor);
+#elif defined(PLATFORM_UNIX)
+        ::close(m_fileDescriptor);
+#endif
+    }
+    m_fileDescriptor = -1;
+    m_ownsFileDescriptor = false;
+    m_fileSize = 0;
+    setg(nullptr, nullptr, nullptr);
+}
+
+/*!
+ * \brief Ensures the next character is available in the get area waiting for the background thread if necessary.
+ * \throws Throws std::ios_base::failure if reading ahead the requested data failed.
+ */
+ReadAheadBuffer::int_type ReadAheadBuffer::underflow()
+{
+    if (gptr() < egptr()) {
+        return traits_type::to_int_type(*gptr());
+    }
+    if (m_fileDescriptor == -1) {
+        return traits_type::eof();
+    }
+    const auto position = m_getAreaOffset + static_cast<std::uint64_t>(egptr() - eback());
+    setg(nullptr, nullptr, nullptr);
+    m_getAreaOffset = position;
+
+    auto lock = std::unique_lock(m_mutex);
+    // release buffers which are not needed anymore (the one which has just been read and those skipped via seeking)
+    for (; m_filled && m_slots[m_head].offset + m_slots[m_head].size <= position; --m_filled) {
+        m_head = (m_head + 1) % m_slots.size();
+    }
+    // discard prefetched data if the position is not within it (because we've seeked elsewhere)
+    if (m_filled ? m_slots[m_head].offset > position : m_prefetchOffset != position) {
+        ++m_generation;
+        m_filled = 0;
+        m_prefetchOffset = position;
+        m_endReached = false;
+        m_error.clear();
+    }
+    m_condition.notify_all();
+    m_condition.wait(lock, [this] { return m_filled || m_endReached || m_error; });
+    if (!m_filled) {
+        if (m_error) {
+            throw std::ios_base::failure("unable to read ahead", m_error);
+        }
+        return traits_type::eof();
+    }
+    const auto &slot = m_slots[m_head];
+    m_getAreaOffset = slot.offset;
+    setg(slot.data.get(), slot.data.get() + (position - slot.offset), slot.data.get() + slot.size);
+    return traits_type::to_int_type(*gptr());
+}
+
+/*!
+ * \brief Sets the position relative to the beginning, the end or the current position.
+ * \remarks The position is only changed within the current get area if possible; otherwise it is only recorded and
+ *          underflow() decides whether prefetched data can be kept.
+ */
+ReadAheadBuffer::pos_type ReadAheadBuffer::seekoff(off_type off, std::ios_base::seekdir dir, std::ios_base::openmode which)
+{
+    if (!(which & std::ios_base::in) || m_fileDescriptor == -1) {
+        return pos_type(off_type(-1));
+    }
+    const auto areaOffset = static_cast<off_type>(m_getAreaOffset);
+    auto position = off;
+    switch (dir) {
+    case std::ios_base::beg:
+        break;
+    case std::ios_base::cur:
+        position += areaOffset + (gptr() - eback());
+        break;
+    case std::ios_base::end:
+        position += static_cast<off_type>(m_fileSize);
+        break;
+    default:
+        return pos_type(off_type(-1));
+    }
+    if (position < 0) {
+        return pos_type(off_type(-1));
+    }
+    if (eback() && position >= areaOffset && position <= areaOffset + (egptr() - eback())) {
+        setg(eback(), eback() + (position - areaOffset), egptr());
+    } else {
+        setg(nullptr, nullptr, nullptr);
+        m_getAreaOffset = static_cast<std::uint64_t>(position);
+    }
+    return pos_type(position);
+}
+
+/*!
+ * \brief Sets the position relative to the beginning.
+ */
+ReadAheadBuffer::pos_type ReadAheadBuffer::seekpos(pos_type pos, std::ios_base::openmode which)
+{
+    return seekoff(off_type(pos), std::ios_base::beg, which);
+}
+
+/*!
+ * \brief Returns the number of bytes remaining in the file according to the size determined when opening it.
+ */
+std::streamsize ReadAheadBuffer::showmanyc()
+{
+    const auto position = m_getAreaOffset + static_cast<std::uint64_t>(gptr() - eback());
+    return m_fileDescriptor != -1 && position < m_fileSize ? static_cast<std::streamsize>(m_fileSize - position) : -1;
+}
+
+/*!
+ * \brief Determines the file size, allocates the buffers (if not done yet) and starts the background thread.
+ */
+void ReadAheadBuffer::start(int fileDescriptor, bool ownsFileDescriptor)
+{
+#if defined(PLATFORM_WINDOWS)
+    struct _stat64 fileInfo;
+    if (_fstat64(fileDescriptor, &fileInfo) == -1) {
+        throw std::ios_base::failure("_fstat64 failed", std::error_code(errno, std::system_category()));
+    }
+#elif defined(PLATFORM_UNIX)
+    struct stat fileInfo;
+    if (fstat(fileDescriptor, &fileInfo) == -1) {
+        throw std::ios_base::failure("fstat failed", std::error_code(errno, std::system_category()));
+    }
+#if defined(POSIX_FADV_SEQUENTIAL)
+    posix_fadvise(fileDescriptor, 0, 0, POSIX_FADV_SEQUENTIAL);
+#endif
+#else
+    throw std::ios_base::failure("reading ahead is not supported on this platform");
+#endif
+#if defined(PLATFORM_WINDOWS) || defined(PLATFORM_UNIX)
+    for (auto &slot : m_slots) {
+        if (!slot.data) {
+            slot.data = std::make_unique<char[]>(m_bufferSize);
+        }
+    }
+    m_fileSize = static_cast<std::uint64_t>(fileInfo.st_size);
+    m_fileDescriptor = fileDescriptor;
+    m_ownsFileDescriptor = ownsFileDescriptor;
+    m_head = m_filled = 0;
+    m_prefetchOffset = m_getAreaOffset = 0;
+    m_error.clear();
+    m_endReached = m_stopping = false;
+    setg(nullptr, nullptr, nullptr);
+    m_thread = std::thread(&ReadAheadBuffer::prefetch, this);
+#endif
+}
+
+/*!
+ * \brief Fills the buffers ahead of the current position; runs within the background thread.
+ */
+void ReadAheadBuffer::prefetch()
+{
+    auto lock = std::unique_lock(m_mutex);
+    for (;;) {
+        m_condition.wait(lock, [this] { return m_stopping || (m_filled < m_slots.size() && !m_endReached && !m_error); });
+        if (m_stopping) {
+            return;
+        }
+
+        // read into the next free buffer without holding the lock
+        auto &slot = m_slots[(m_head + m_filled) % m_slots.size()];
+        const auto offset = m_prefetchOffset;
+        const auto generation = m_generation;
+        lock.unlock();
+        auto ec = std::error_code();
+        const auto bytesRead = Detail::readAt(m_fileDescriptor, slot.data.get(), m_bufferSize, offset, ec);
+        lock.lock();
+
+        // discard the data if it has been invalidated by seeking meanwhile
+        if (generation != m_generation) {
+            continue;
+        }
+        if (ec) {
+            m_error = ec;
+        } else {
+            slot.offset = offset;
+            slot.size = bytesRead;
+            m_prefetchOffset += bytesRead;
+            m_endReached = bytesRead < m_bufferSize;
+            m_filled += bytesRead ? 1 : 0;
+        }
+        m_condition.notify_all();
+    }
+}
+
+} // namespace CppUtilities
@@ -0,0 +1,131 @@
+#ifndef IOUTILITIES_READAHEADBUFFER_H
+#define IOUTILITIES_READAHEADBUFFER_H
+
+#include "../global.h"
+
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <streambuf>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+namespace CppUtilities {
+
+class CPP_UTILITIES_EXPORT ReadAheadBuffer : public std::streambuf {
+public:
+    explicit ReadAheadBuffer(std::size_t bufferSize = defaultBufferSize, std::size_t bufferCount = defaultBufferCount);
+    explicit ReadAheadBuffer(
+        const std::string &path, std::size_t bufferSize = defaultBufferSize, std::size_t bufferCount = defaultBufferCount);
+    explicit ReadAheadBuffer(int fileDescriptor, std::size_t bufferSize = defaultBufferSize, std::size_t bufferCount = defaultBufferCount);
+    ReadAheadBuffer(const ReadAheadBuffer &) = delete;
+    ReadAheadBuffer &operator=(const ReadAheadBuffer &) = delete;
+    ~ReadAheadBuffer() override;
+
+    bool isOpen() const;
+    void open(const std::string &path);
+    void open(int fileDescriptor);
+    void close();
+    std::size_t bufferSize() const;
+    std::size_t bufferCount() const;
+    std::uint64_t fileSize() const;
+
+    static constexpr std::size_t defaultBufferSize = 1024 * 1024;
+    static constexpr std::size_t defaultBufferCount = 4;
+
+protected:
+    int_type underflow() override;
+    pos_type seekoff(off_type off, std::ios_base::seekdir dir, std::ios_base::openmode which = std::ios_base::in) override;
+    pos_type seekpos(pos_type pos, std::ios_base::openmode which = std::ios_base::in) override;
+    std::streamsize showmanyc() override;
+
+private:
+    struct Slot {
+        std::unique_ptr<char[]> data;
+        std::uint64_t offset = 0;
+        std::size_t size = 0;
+    };
+
+    void start(int fileDescriptor, bool ownsFileDescriptor);
+    void prefetch();
+
+    std::vector<Slot> m_slots;
+    std::size_t m_bufferSize;
+    std::thread m_thread;
+    std::mutex m_mutex;
+    std::condition_variable m_condition;
+    // state shared with the prefetching thread (guarded by m_mutex)
+    std::size_t m_head;
+    std::size_t m_filled;
+    std::uint64_t m_prefetchOffset;
+    std::uint64_t m_generation;
+    std::error_code m_error;
+    bool m_endReached;
+    bool m_stopping;
+    // state only accessed by the reading thread
+    std::uint64_t m_getAreaOffset;
+    std::uint64_t m_fileSize;
+    int m_fileDescriptor;
+    bool m_ownsFileDescriptor;
+};
+
+/*!
+ * \brief Constructs a ReadAheadBuffer and opens the file at the specified (UTF-8 encoded) \a path.
+ * \throws Throws std::ios_base::failure if the file can not be opened.
+ */
+inline ReadAheadBuffer::ReadAheadBuffer(const std::string &path, std::size_t bufferSize, std::size_t bufferCount)
+    : ReadAheadBuffer(bufferSize, bufferCount)
+{
+    open(path);
+}
+
+/*!
+ * \brief Constructs a ReadAheadBuffer for the file the specified \a fileDescriptor refers to.
+ * \remarks Does not take ownership over \a fileDescriptor.
+ * \throws Throws std::ios_base::failure if the size of the file can not be determined.
+ */
+inline ReadAheadBuffer::ReadAheadBuffer(int fileDescriptor, std::size_t bufferSize, std::size_t bufferCount)
+    : ReadAheadBuffer(bufferSize, bufferCount)
+{
+    open(fileDescriptor);
+}
+
+/*!
+ * \brief Returns whether a file is open.
+ */
+inline bool ReadAheadBuffer::isOpen() const
+{
+    return m_fileDescriptor != -1;
+}
+
+/*!
+ * \brief Returns the size of a single buffer.
+ */
+inline std::size_t ReadAheadBuffer::bufferSize() const
+{
+    return m_bufferSize;
+}
+
+/*!
+ * \brief Returns the number of buffers which are kept filled ahead of the current position.
+ * \remarks This includes the buffer which is currently read from.
+ */
+inline std::size_t ReadAheadBuffer::bufferCount() const
+{
+    return m_slots.size();
+}
+
+/*!
+ * \brief Returns the size of the file at the time it has been opened.
+ */
+inline std::uint64_t ReadAheadBuffer::fileSize() const
+{
+    return m_fileSize;
+}
+
+} // namespace CppUtilities
+
+#endif // IOUTILITIES_READAHEADBUFFER_H
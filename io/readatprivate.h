@@ -0,0 +1,80 @@
+#ifndef IOUTILITIES_READAT_PRIVATE_H
+#define IOUTILITIES_READAT_PRIVATE_H
+
+#include "../global.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdint>
+#include <limits>
+#include <system_error>
+
+#if defined(PLATFORM_WINDOWS)
+#include <io.h>
+#include <windows.h>
+#elif defined(PLATFORM_UNIX)
+#include <unistd.h>
+#endif
+
+namespace CppUtilities {
+
+/// \cond
+namespace Detail {
+
+/*!
+ * \brief Reads up to \a size bytes at the specified \a offset of the file \a fileDescriptor refers to into \a buffer.
+ * \returns Returns the number of bytes read which is only less than \a size if the end of the file has been reached or
+ *          an error occurred. In the latter case \a ec is set.
+ * \remarks Does not alter the file position so it can be called while the file descriptor is used elsewhere.
+ */
+inline std::size_t readAt(int fileDescriptor, char *buffer, std::size_t size, std::uint64_t offset, std::error_code &ec)
+{
+    auto bytesRead = std::size_t();
+#if defined(PLATFORM_UNIX)
+    while (bytesRead < size) {
+        const auto res = ::pread(fileDescriptor, buffer + bytesRead, size - bytesRead, static_cast<off_t>(offset + bytesRead));
+        if (res > 0) {
+            bytesRead += static_cast<std::size_t>(res);
+        } else if (!res) {
+            break;
+        } else if (errno != EINTR) {
+            ec = std::error_code(errno, std::system_category());
+            break;
+        }
+    }
+#elif defined(PLATFORM_WINDOWS)
+    const auto fileHandle = reinterpret_cast<HANDLE>(_get_osfhandle(fileDescriptor));
+    while (bytesRead < size) {
+        const auto position = offset + bytesRead;
+        auto overlapped = OVERLAPPED();
+        overlapped.Offset = static_cast<DWORD>(position);
+        overlapped.OffsetHigh = static_cast<DWORD>(position >> 32);
+        auto res = DWORD();
+        const auto chunkSize = static_cast<DWORD>(std::min<std::size_t>(size - bytesRead, std::numeric_limits<DWORD>::max()));
+        if (!ReadFile(fileHandle, buffer + bytesRead, chunkSize, &res, &overlapped)) {
+            if (const auto error = GetLastError(); error != ERROR_HANDLE_EOF) {
+                ec = std::error_code(static_cast<int>(error), std::system_category());
+            }
+            break;
+        }
+        if (!res) {
+            break;
+        }
+        bytesRead += res;
+    }
+#else
+    CPP_UTILITIES_UNUSED(fileDescriptor)
+    CPP_UTILITIES_UNUSED(buffer)
+    CPP_UTILITIES_UNUSED(size)
+    CPP_UTILITIES_UNUSED(offset)
+    ec = std::make_error_code(std::errc::not_supported);
+#endif
+    return bytesRead;
+}
+
+} // namespace Detail
+/// \endcond
+
+} // namespace CppUtilities
+
+#endif // IOUTILITIES_READAT_PRIVATE_H
@@ -0,0 +1,325 @@
+#ifndef IOUTILITIES_RECORD_H
+#define IOUTILITIES_RECORD_H
+
+#include "../conversion/binaryconversion.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <utility>
+
+namespace CppUtilities {
+
+/// \cond
+namespace Detail {
+
+template <typename MemberPointer> struct RecordMember;
+template <typename ClassType, typename MemberType> struct RecordMember<MemberType ClassType::*> {
+    using Class = ClassType;
+    using Member = MemberType;
+};
+template <auto member> using RecordMemberType = typename RecordMember<decltype(member)>::Member;
+
+template <typename Type, typename = void> struct RecordIntegerType {
+    using type = Type;
+};
+template <typename Type> struct RecordIntegerType<Type, std::enable_if_t<std::is_enum_v<Type>>> {
+    using type = std::underlying_type_t<Type>;
+};
+
+/*!
+ * \brief Returns the unsigned integer type with exactly \a size bytes or std::uint64_t if there is none.
+ */
+template <std::size_t size> constexpr auto recordStorageType()
+{
+    if constexpr (size == 1) {
+        return std::uint8_t();
+    } else if constexpr (size == 2) {
+        return std::uint16_t();
+    } else if constexpr (size == 4) {
+        return std::uint32_t();
+    } else {
+        return std::uint64_t();
+    }
+}
+
+/*!
+ * \brief Decodes the \a size bytes long integer stored at \a buffer using the byte order specified via \a bigEndian.
+ * \remarks Integers with an odd width (e.g. 24, 40 or 56 bit) are sign-extended if \a Integer is signed.
+ */
+template <typename Integer, std::size_t size, bool bigEndian> inline Integer decodeRecordInteger(const char *buffer)
+{
+    using Storage = decltype(recordStorageType<size>());
+    auto value = Storage();
+    if constexpr (size == 1) {
+        value = static_cast<Storage>(*buffer);
+    } else if constexpr (sizeof(Storage) == size) {
+        value = bigEndian ? BE::toInt<Storage>(buffer) : LE::toInt<Storage>(buffer);
+    } else {
+        char padded[sizeof(Storage)] = {};
+        if constexpr (bigEndian) {
+            std::memcpy(padded + sizeof(Storage) - size, buffer, size);
+            value = BE::toInt<Storage>(padded);
+        } else {
+            std::memcpy(padded, buffer, size);
+            value = LE::toInt<Storage>(padded);
+        }
+    }
+    if constexpr (std::is_signed_v<Integer> && size < sizeof(Storage)) {
+        constexpr auto shift = (sizeof(Storage) - size) * 8;
+        return static_cast<Integer>(static_cast<std::make_signed_t<Storage>>(value << shift) >> shift);
+    } else {
+        return static_cast<Integer>(static_cast<std::conditional_t<std::is_signed_v<Integer>, std::make_signed_t<Storage>, Storage>>(value));
+    }
+}
+
+/*!
+ * \brief Stores the \a size least significant bytes of \a value at \a buffer using the byte order specified via \a bigEndian.
+ */
+template <std::size_t size, bool bigEndian, typename Integer> inline void encodeRecordInteger(Integer value, char *buffer)
+{
+    using Storage = decltype(recordStorageType<size>());
+    const auto storage = static_cast<Storage>(value);
+    if constexpr (size == 1) {
+        *buffer = static_cast<char>(storage);
+    } else if constexpr (sizeof(Storage) == size) {
+        bigEndian ? BE::getBytes(storage, buffer) : LE::getBytes(storage, buffer);
+    } else {
+        char padded[sizeof(Storage)];
+        if constexpr (bigEndian) {
+            BE::getBytes(storage, padded);
+            std::memcpy(buffer, padded + sizeof(Storage) - size, size);
+        } else {
+            LE::getBytes(storage, padded);
+            std::memcpy(buffer, padded, size);
+        }
+    }
+}
+
+template <auto member, std::size_t fieldSize, bool bigEndian> struct RecordNumberField {
+    using Member = RecordMemberType<member>;
+    using Integer = typename RecordIntegerType<Member>::type;
+    static_assert(std::is_arithmetic_v<Integer>, "only arithmetic types and enums can be stored as numbers");
+    static_assert(std::is_integral_v<Integer> || fieldSize == sizeof(Member), "floating point numbers must be stored with their native size");
+    static_assert(fieldSize >= 1 && fieldSize <= sizeof(Integer), "integers can not be stored with more bytes than their type has");
+    static constexpr std::size_t size = fieldSize;
+
+    template <typename Record> static void decode(const char *buffer, Record &record)
+    {
+        if constexpr (std::is_same_v<Integer, float>) {
+            record.*member = bigEndian ? BE::toFloat32(buffer) : LE::toFloat32(buffer);
+        } else if constexpr (std::is_same_v<Integer, double>) {
+            record.*member = bigEndian ? BE::toFloat64(buffer) : LE::toFloat64(buffer);
+        } else {
+            record.*member = static_cast<Member>(decodeRecordInteger<Integer, size, bigEndian>(buffer));
+        }
+    }
+
+    template <typename Record> static void encode(const Record &record, char *buffer)
+    {
+        if constexpr (std::is_floating_point_v<Integer>) {
+            bigEndian ? BE::getBytes(record.*member, buffer) : LE::getBytes(record.*member, buffer);
+        } else {
+            encodeRecordInteger<size, bigEndian>(static_cast<Integer>(record.*member), buffer);
+        }
+    }
+};
+
+} // namespace Detail
+/// \endcond
+
+/*!
+ * \brief The BigEndianField class describes a member of a record which is stored as big endian number with \a size bytes.
+ * \remarks
+ * - Integers may be stored with fewer bytes than their type has (e.g. 24, 40 or 56 bit). Signed integers are sign-extended
+ *   when being read in this case.
+ * - Enums are stored as their underlying type.
+ * \sa RecordSchema
+ */
+template <auto member, std::size_t size = sizeof(Detail::RecordMemberType<member>)>
+struct BigEndianField : public Detail::RecordNumberField<member, size, true> {
+};
+
+/*!
+ * \brief The LittleEndianField class describes a member of a record which is stored as little endian number with \a size bytes.
+ * \remarks Same as BigEndianField except for the byte order.
+ * \sa RecordSchema
+ */
+template <auto member, std::size_t size = sizeof(Detail::RecordMemberType<member>)>
+struct LittleEndianField : public Detail::RecordNumberField<member, size, false> {
+};
+
+/*!
+ * \brief The SynchsafeField class describes a member of a record which is stored as 32-bit big endian synchsafe integer.
+ * \sa toSynchsafeInt(), toNormalInt()
+ */
+template <auto member> struct SynchsafeField {
+    static_assert(std::is_integral_v<Detail::RecordMemberType<member>>, "synchsafe integers must be stored in integral members");
+    static constexpr std::size_t size = 4;
+
+    template <typename Record> static void decode(const char *buffer, Record &record)
+    {
+        record.*member = static_cast<Detail::RecordMemberType<member>>(toNormalInt(BE::toInt<std::uint32_t>(buffer)));
+    }
+
+    template <typename Record> static void encode(const Record &record, char *buffer)
+    {
+        BE::getBytes(toSynchsafeInt(static_cast<std::uint32_t>(record.*member)), buffer);
+    }
+};
+
+/*!
+ * \brief The BytesField class describes a member of a record which is stored as-is, e.g. a character array holding a FourCC.
+ */
+template <auto member> struct BytesField {
+    static_assert(std::is_trivially_copyable_v<Detail::RecordMemberType<member>>, "only trivially copyable members can be stored as-is");
+    static constexpr std::size_t size = sizeof(Detail::RecordMemberType<member>);
+
+    template <typename Record> static void decode(const char *buffer, Record &record)
+    {
+        std::memcpy(&(record.*member), buffer, size);
+    }
+
+    template <typename Record> static void encode(const Record &record, char *buffer)
+    {
+        std::memcpy(buffer, &(record.*member), size);
+    }
+};
+
+/*!
+ * \brief The ReservedField class describes \a reservedSize bytes of a record which are skipped when reading and zeroed when writing.
+ */
+template <std::size_t reservedSize> struct ReservedField {
+    static constexpr std::size_t size = reservedSize;
+
+    template <typename Record> static void decode(const char *, Record &)
+    {
+    }
+
+    template <typename Record> static void encode(const Record &, char *buffer)
+    {
+        std::memset(buffer, 0, size);
+    }
+};
+
+/*!
+ * \brief The RecordTraits class provides the schema of a record type.
+ *
+ * By default the schema is taken from the member type "RecordSchema" of the record type. Specialize this template
+ * to provide a schema for a type which can not be altered.
+ */
+template <typename Record> struct RecordTraits {
+    using Schema = typename Record::RecordSchema;
+};
+
+/*!
+ * \brief The RecordSchema class describes the binary layout of a fixed-size record.
+ *
+ * The schema consists of a sequence of fields (BigEndianField, LittleEndianField, SynchsafeField, BytesField, ReservedField
+ * and RecordField) which are stored one after another without any padding. The offsets of the fields are computed at
+ * compile time so decoding/encoding a record boils down to a fixed sequence of loads/stores. A record is usually declared
+ * like this:
+ * ```
+ * struct MovieHeader {
+ *     std::uint8_t version;
+ *     std::uint32_t flags;
+ *     std::uint32_t timeScale;
+ *     std::uint64_t duration;
+ *     using RecordSchema = CppUtilities::RecordSchema<BigEndianField<&MovieHeader::version>,
+ *         BigEndianField<&MovieHeader::flags, 3>, ReservedField<8>, BigEndianField<&MovieHeader::timeScale>,
+ *         BigEndianField<&MovieHeader::duration, 5>>;
+ * };
+ * ```
+ * \sa BinaryReader::readRecord(), BinaryWriter::writeRecord()
+ */
+template <typename... Fields> struct RecordSchema {
+    static constexpr std::size_t size = (Fields::size + ... + 0);
+
+    template <typename Record> static void decode(const char *buffer, Record &record)
+    {
+        decode(buffer, record, std::index_sequence_for<Fields...>());
+    }
+
+    template <typename Record> static void encode(const Record &record, char *buffer)
+    {
+        encode(record, buffer, std::index_sequence_for<Fields...>());
+    }
+
+private:
+    template <std::size_t index> static constexpr std::size_t offset()
+    {
+        constexpr std::size_t sizes[] = { Fields::size..., 0 };
+        auto offset = std::size_t();
+        for (auto i = std::size_t(); i != index; ++i) {
+            offset += sizes[i];
+        }
+        return offset;
+    }
+
+    template <typename Record, std::size_t... indices> static void decode(const char *buffer, Record &record, std::index_sequence<indices...>)
+    {
+        (Fields::decode(buffer + offset<indices>(), record), ...);
+    }
+
+    template <typename Record, std::size_t... indices> static void encode(const Record &record, char *buffer, std::index_sequence<indices...>)
+    {
+        (Fields::encode(record, buffer + offset<indices>()), ...);
+    }
+};
+
+/*!
+ * \brief The number of bytes a record of the specified type occupies.
+ */
+template <typename Record> constexpr std::size_t recordSize = RecordTraits<Record>::Schema::size;
+
+/*!
+ * \brief Decodes the record stored at \a buffer into \a record.
+ * \remarks The \a buffer must be at least recordSize<Record> bytes long.
+ */
+template <typename Record> inline void decodeRecord(const char *buffer, Record &record)
+{
+    RecordTraits<Record>::Schema::decode(buffer, record);
+}
+
+/*!
+ * \brief Encodes the specified \a record into \a buffer.
+ * \remarks The \a buffer must be at least recordSize<Record> bytes long.
+ */
+template <typename Record> inline void encodeRecord(const Record &record, char *buffer)
+{
+    RecordTraits<Record>::Schema::encode(record, buffer);
+}
+
+/*!
+ * \brief The RecordField class describes a member of a record which is a record itself.
+ */
+template <auto member> struct RecordField {
+    static constexpr std::size_t size = recordSize<Detail::RecordMemberType<member>>;
+
+    template <typename Record> static void decode(const char *buffer, Record &record)
+    {
+        decodeRecord(buffer, record.*member);
+    }
+
+    template <typename Record> static void encode(const Record &record, char *buffer)
+    {
+        encodeRecord(record.*member, buffer);
+    }
+};
+
+/// \cond
+namespace Detail {
+/*!
+ * \brief Returns the number of records of the specified type which are buffered at once when reading/writing arrays of records.
+ */
+template <typename Record> constexpr std::size_t recordsPerChunk()
+{
+    return recordSize<Record> < 4096 ? 4096 / recordSize<Record> : 1;
+}
+} // namespace Detail
+/// \endcond
+
+} // namespace CppUtilities
+
+#endif // IOUTILITIES_RECORD_H
@@ -0,0 +1,189 @@
+#include "./streambitreader.h"
+
+#include <algorithm>
+#include <cstring>
+#include <ios>
+
+using namespace std;
+
+namespace CppUtilities {
+
+/*!
+ * \class StreamBitReader
+ * \brief The StreamBitReader class provides bitwise reading of data from a stream.
+ *
+ * Unlike BitReader, the data does not need to be in memory as a whole. It is read in chunks of chunkSize() bytes from a
+ * std::istream (via a BinaryReader) as bits are consumed. Reading is done via an underlying BitReader so the API and the
+ * performance characteristics are the same. Skipping over big parts of the stream via skipBits() seeks the stream
+ * instead of reading the skipped bytes.
+ *
+ * The StreamBitReader starts reading at the current position of the stream. Because it reads ahead, the position of the
+ * stream is usually ahead of the current position of the StreamBitReader. Call sync() before using the stream directly.
+ *
+ * Like BitReader, the StreamBitReader can skip emulation prevention bytes (see setSkippingEmulationPreventionBytes()).
+ * The last bytes of the previous chunk are kept in front of the next one so emulation prevention bytes crossing the
+ * boundary of chunks are detected as well.
+ */
+
+/*!
+ * \brief Constructs a new StreamBitReader reading from the specified \a stream.
+ * \remarks Does not take ownership over \a stream.
+ */
+StreamBitReader::StreamBitReader(std::istream &stream, std::size_t chunkSize)
+    : m_ownedSource(std::make_unique<BinaryReader>(&stream))
+    , m_source(m_ownedSource.get())
+    , m_chunkSize(std::max<std::size_t>(chunkSize, 64))
+    , m_chunk(std::make_unique<char[]>(m_chunkSize))
+    , m_reader(m_chunk.get(), std::size_t())
+    , m_endOfStream(false)
+{
+    // determine the start position before reading anything so the position can be tracked by the BinaryReader
+    m_source->position();
+}
+
+/*!
+ * \brief Constructs a new StreamBitReader reading via the specified \a reader.
+ * \remarks Does not take ownership over \a reader. The position and size cached by \a reader are used (and kept up to date).
+ */
+StreamBitReader::StreamBitReader(BinaryReader &reader, std::size_t chunkSize)
+    : m_source(&reader)
+    , m_chunkSize(std::max<std::size_t>(chunkSize, 64))
+    , m_chunk(std::make_unique<char[]>(m_chunkSize))
+    , m_reader(m_chunk.get(), std::size_t())
+    , m_endOfStream(false)
+{
+    // determine the start position before reading anything so the position can be tracked by the BinaryReader
+    m_source->position();
+}
+
+/*!
+ * \brief Returns the number of bits which are still available to read until the end of the stream.
+ * \remarks
+ * - Determines the size of the stream (via BinaryReader::remaining()) which requires the stream to be seekable.
+ * - If emulation prevention bytes are skipped, only those within the buffered data are taken into account so the
+ *   returned value is an upper bound.
+ */
+std::uint64_t StreamBitReader::bitsAvailable()
+{
+    return m_reader.bitsAvailable() + m_source->remaining() * 8;
+}
+
+/*!
+ * \brief Skips the specified number of bits.
+ * \remarks If \a bitCount exceeds the buffered bits, the stream is seeked so the skipped bytes are not read. This is not
+ *          possible when skipping emulation prevention bytes because the ones within the skipped bytes need to be left
+ *          out; then the skipped bytes are read chunk by chunk.
+ * \throws Throws std::ios_base::failure if the end of the stream is exceeded.
+ */
+void StreamBitReader::skipBits(std::uint64_t bitCount)
+{
+    const auto buffered = m_reader.bitsAvailable();
+    if (bitCount <= buffered) {
+        m_reader.skipBits(static_cast<std::size_t>(bitCount));
+        return;
+    }
+    if (m_reader.m_skippingEscapes) {
+        for (auto available = buffered; bitCount > available; available = m_reader.bitsAvailable()) {
+            m_reader.skipBits(available);
+            bitCount -= available;
+            fill();
+            if (!m_reader.bitsAvailable()) {
+                throw std::ios_base::failure("end of stream exceeded");
+            }
+        }
+        m_reader.skipBits(static_cast<std::size_t>(bitCount));
+        return;
+    }
+    bitCount -= buffered;
+    m_reader.reset(m_chunk.get(), std::size_t());
+    m_endOfStream = false;
+    if (const auto bytes = bitCount / 8) {
+        if (bytes > m_source->remaining()) {
+            throw std::ios_base::failure("end of stream exceeded");
+        }
+        m_source->seek(m_source->position() + bytes);
+    }
+    if ((bitCount %= 8)) {
+        prepare(8).skipBits(static_cast<std::size_t>(bitCount));
+    }
+}
+
+/*!
+ * \brief Re-establishes alignment and seeks the stream back to the current position discarding buffered data.
+ * \remarks
+ * - Call this function before using the stream (or the BinaryReader) directly again. Reading bits may be continued
+ *   afterwards.
+ * - The already consumed bytes are kept so emulation prevention bytes directly after the current position are still
+ *   detected when reading bits is continued (without using the stream directly in between).
+ */
+void StreamBitReader::sync()
+{
+    m_reader.align();
+    // determine the position of the bytes within the cache leaving out emulation prevention bytes in between
+    const auto *const chunk = reinterpret_cast<const std::uint8_t *>(m_chunk.get());
+    auto *position = m_reader.m_buffer;
+    for (auto cachedBytes = m_reader.m_cacheBits / 8; cachedBytes;) {
+        --position;
+        const auto isEscape = m_reader.m_skippingEscapes && position - chunk >= 2 && position[0] == 0x03 && !position[-1] && !position[-2];
+        if (!isEscape) {
+            --cachedBytes;
+        }
+    }
+    const auto unreadBytes = static_cast<std::size_t>(m_reader.m_end - position);
+    m_reader.m_cache = 0;
+    m_reader.m_cacheBits = 0;
+    m_reader.m_buffer = m_reader.m_end = position;
+    m_reader.locateEmulationPreventionBytes(position);
+    m_endOfStream = false;
+    if (unreadBytes) {
+        m_source->seek(m_source->position() - unreadBytes);
+    }
+}
+
+/*!
+ * \brief Sets whether emulation prevention bytes are skipped.
+ * \remarks Must be set before reading (or right after sync()) because bits which are already buffered are not taken into
+ *          account.
+ * \sa BitReader::setSkippingEmulationPreventionBytes()
+ */
+void StreamBitReader::setSkippingEmulationPreventionBytes(bool skipping)
+{
+    const auto *const chunk = reinterpret_cast<const std::uint8_t *>(m_chunk.get());
+    m_reader.m_skippingEscapes = skipping;
+    m_reader.locateEmulationPreventionBytes(m_reader.m_buffer - std::min<std::ptrdiff_t>(m_reader.m_buffer - chunk, 2));
+}
+
+/*!
+ * \brief Reads the next chunk from the stream keeping the bits which have not been consumed yet.
+ * \remarks
+ * - Reading one chunk is always sufficient because the chunk size is at least 64 bytes and prepare() is never
+ *   required to provide more than 128 bits.
+ * - Up to contextSize already consumed bytes are kept in front of the buffered data. The last two of them are required to
+ *   detect emulation prevention bytes at the beginning of the buffered data and sync() needs the ones within the cache.
+ */
+void StreamBitReader::fill()
+{
+    auto *const stream = m_source->stream();
+    if (!stream || m_endOfStream) {
+        return;
+    }
+    // move the context and the remaining bytes to the front of the chunk (the cache of the BitReader is not affected by this)
+    const auto *const chunk = reinterpret_cast<const std::uint8_t *>(m_chunk.get());
+    const auto contextBytes = std::min(static_cast<std::size_t>(m_reader.m_buffer - chunk), contextSize);
+    const auto remainingBytes = static_cast<std::size_t>(m_reader.m_end - m_reader.m_buffer);
+    const auto keptBytes = contextBytes + remainingBytes;
+    std::memmove(m_chunk.get(), m_reader.m_buffer - contextBytes, keptBytes);
+    m_source->read(m_chunk.get() + keptBytes, static_cast<std::streamsize>(m_chunkSize - keptBytes));
+    const auto bytesRead = static_cast<std::size_t>(stream->gcount());
+    if (stream->eof() && !stream->bad()) {
+        // clear the eofbit and the failbit caused by hitting the end so the stream can still be used (e.g. tellg() does
+        // not fail) and remember the end has been reached instead
+        stream->clear();
+        m_endOfStream = true;
+    }
+    m_reader.m_buffer = chunk + contextBytes;
+    m_reader.m_end = m_reader.m_buffer + remainingBytes + bytesRead;
+    m_reader.locateEmulationPreventionBytes(m_reader.m_buffer - std::min<std::size_t>(contextBytes, 2));
+}
+
+} // namespace CppUtilities
@@ -0,0 +1,154 @@
+#ifndef IOUTILITIES_STREAMBITREADER_H
+#define IOUTILITIES_STREAMBITREADER_H
+
+#include "./binaryreader.h"
+#include "./bitreader.h"
+
+#include "../global.h"
+
+#include <cstdint>
+#include <istream>
+#include <memory>
+
+namespace CppUtilities {
+
+class CPP_UTILITIES_EXPORT StreamBitReader {
+public:
+    explicit StreamBitReader(std::istream &stream, std::size_t chunkSize = defaultChunkSize);
+    explicit StreamBitReader(BinaryReader &reader, std::size_t chunkSize = defaultChunkSize);
+    StreamBitReader(const StreamBitReader &) = delete;
+    StreamBitReader &operator=(const StreamBitReader &) = delete;
+
+    template <typename intType> intType readBits(std::uint8_t bitCount);
+    std::uint8_t readBit();
+    template <typename intType> intType readUnsignedExpGolombCodedBits();
+    template <typename intType> intType readSignedExpGolombCodedBits();
+    template <typename intType> intType showBits(std::uint8_t bitCount);
+    void skipBits(std::uint64_t bitCount);
+    void align();
+    std::uint64_t bitsAvailable();
+    bool isSkippingEmulationPreventionBytes() const;
+    void setSkippingEmulationPreventionBytes(bool skipping);
+    BitReader &prepare(std::size_t bitCount);
+    void sync();
+    BinaryReader &source();
+    std::size_t chunkSize() const;
+
+    static constexpr std::size_t defaultChunkSize = 64 * 1024;
+
+private:
+    void fill();
+
+    /// \brief The number of already consumed bytes which are kept in front of the buffered data when reading the next chunk.
+    static constexpr std::size_t contextSize = 16;
+
+    std::unique_ptr<BinaryReader> m_ownedSource;
+    BinaryReader *m_source;
+    std::size_t m_chunkSize;
+    std::unique_ptr<char[]> m_chunk;
+    BitReader m_reader;
+    bool m_endOfStream;
+};
+
+/*!
+ * \brief Ensures at least \a bitCount bits are buffered (unless the end of the stream is reached) and returns the
+ *        underlying BitReader.
+ *
+ * This allows using functions operating on a BitReader (e.g. VlcTable::decode() or the batch decoders for Exp-Golomb
+ * codes) as long as they do not read more than \a bitCount bits.
+ * \remarks \a bitCount must not exceed 8 * chunkSize().
+ */
+inline BitReader &StreamBitReader::prepare(std::size_t bitCount)
+{
+    if (m_reader.bitsAvailable() < bitCount) {
+        fill();
+    }
+    return m_reader;
+}
+
+/*!
+ * \brief Reads the specified number of bits (at most 64) advancing the current position by \a bitCount bits.
+ * \throws Throws std::ios_base::failure if the end of the stream is exceeded.
+ * \sa BitReader::readBits()
+ */
+template <typename intType> intType StreamBitReader::readBits(std::uint8_t bitCount)
+{
+    return prepare(bitCount).readBits<intType>(bitCount);
+}
+
+/*!
+ * \brief Reads one bit advancing the current position by one bit.
+ * \throws Throws std::ios_base::failure if the end of the stream is exceeded.
+ */
+inline std::uint8_t StreamBitReader::readBit()
+{
+    return prepare(1).readBit();
+}
+
+/*!
+ * \brief Reads "Exp-Golomb coded" bits (unsigned).
+ * \throws Throws std::ios_base::failure if the end of the stream is exceeded or the value does not fit into 64 bits.
+ * \sa BitReader::readUnsignedExpGolombCodedBits()
+ */
+template <typename intType> intType StreamBitReader::readUnsignedExpGolombCodedBits()
+{
+    return prepare(128).readUnsignedExpGolombCodedBits<intType>();
+}
+
+/*!
+ * \brief Reads "Exp-Golomb coded" bits (signed).
+ * \throws Throws std::ios_base::failure if the end of the stream is exceeded or the value does not fit into 64 bits.
+ * \sa BitReader::readSignedExpGolombCodedBits()
+ */
+template <typename intType> intType StreamBitReader::readSignedExpGolombCodedBits()
+{
+    return prepare(128).readSignedExpGolombCodedBits<intType>();
+}
+
+/*!
+ * \brief Reads the specified number of bits (at most 64) without advancing the current position.
+ * \throws Throws std::ios_base::failure if the end of the stream is exceeded.
+ */
+template <typename intType> intType StreamBitReader::showBits(std::uint8_t bitCount)
+{
+    return prepare(bitCount).showBits<intType>(bitCount);
+}
+
+/*!
+ * \brief Skips the remaining bits of the current byte.
+ * \remarks Does nothing if the current position is already at a byte boundary.
+ */
+inline void StreamBitReader::align()
+{
+    m_reader.align();
+}
+
+/*!
+ * \brief Returns whether emulation prevention bytes are skipped.
+ * \sa setSkippingEmulationPreventionBytes()
+ */
+inline bool StreamBitReader::isSkippingEmulationPreventionBytes() const
+{
+    return m_reader.isSkippingEmulationPreventionBytes();
+}
+
+/*!
+ * \brief Returns the BinaryReader the data is read from.
+ * \remarks The position of its stream is ahead of the current position of the StreamBitReader unless sync() is called.
+ */
+inline BinaryReader &StreamBitReader::source()
+{
+    return *m_source;
+}
+
+/*!
+ * \brief Returns the number of bytes which are read from the stream at once.
+ */
+inline std::size_t StreamBitReader::chunkSize() const
+{
+    return m_chunkSize;
+}
+
+} // namespace CppUtilities
+
+#endif // IOUTILITIES_STREAMBITREADER_H
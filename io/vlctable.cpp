@@ -0,0 +1,113 @@
+#include "./vlctable.h"
+
+#include <algorithm>
+
+using namespace std;
+
+namespace CppUtilities {
+
+/*!
+ * \class VlcTable
+ * \brief The VlcTable class decodes variable-length codes (e.g. Huffman codes) via multi-level lookup tables.
+ *
+ * The root table is indexed by the next rootBits() bits of a BitReader. So all codes with at most rootBits() bits are
+ * resolved via a single lookup. Entries for longer codes refer to sub tables which are indexed by the following bits.
+ * This replaces walking through a code tree bit by bit, e.g.:
+ * ```
+ * const auto table = VlcTable({ { 0b0, 1, 'a' }, { 0b10, 2, 'b' }, { 0b110, 3, 'c' }, { 0b111, 3, 'd' } });
+ * auto reader = BitReader(buffer, size);
+ * const auto symbol = table.decode(reader);
+ * ```
+ *
+ * \remarks
+ * - Codes are read most significant bit first and may be up to 32 bits long.
+ * - The set of codes does not need to be complete. Decoding bits which are not a valid code throws an exception.
+ */
+
+/*!
+ * \brief Builds lookup tables for the specified \a codes.
+ * \param codes Specifies the codes. They must not be a prefix of one another.
+ * \param count Specifies the number of codes.
+ * \param rootBits Specifies the number of bits (1 to 16) used to index the root table (and at most to index sub tables).
+ *        Bigger values lead to fewer lookups for long codes but to bigger tables.
+ * \throws Throws ConversionException if the codes are invalid or ambiguous or if \a rootBits is not supported.
+ */
+VlcTable::VlcTable(const Code *codes, std::size_t count, std::uint8_t rootBits)
+    : m_rootBits(rootBits)
+{
+    if (rootBits < 1 || rootBits > 16) {
+        throw ConversionException("The number of root bits is not supported.");
+    }
+    auto remainingCodes = std::vector<Code>(codes, codes + count);
+    for (const auto &code : remainingCodes) {
+        if (code.length < 1 || code.length > 32 || (code.length < 32 && (code.code >> code.length))) {
+            throw ConversionException("A variable-length code has an invalid length.");
+        }
+    }
+    m_entries.resize(std::size_t(1) << rootBits);
+    build(0, rootBits, remainingCodes);
+}
+
+/*!
+ * \brief Populates the table with \a bits index bits at \a offset with the specified \a codes adding sub tables as needed.
+ * \remarks The bits of the codes used to index the parent tables have already been removed from \a codes.
+ */
+void VlcTable::build(std::size_t offset, std::uint8_t bits, std::vector<Code> &codes)
+{
+    // fill entries of codes which fit into the table (short codes occupy all entries they are a prefix of)
+    auto longCodes = std::vector<Code>();
+    for (const auto &code : codes) {
+        if (code.length > bits) {
+            longCodes.emplace_back(code);
+            continue;
+        }
+        const auto first = offset + (static_cast<std::size_t>(code.code) << (bits - code.length));
+        const auto last = first + (std::size_t(1) << (bits - code.length));
+        for (auto i = first; i != last; ++i) {
+            if (m_entries[i].length) {
+                throw ConversionException("The variable-length codes are ambiguous.");
+            }
+            m_entries[i].value = code.symbol;
+            m_entries[i].length = code.length;
+        }
+    }
+
+    // create sub tables for codes sharing the same prefix
+    const auto prefixOf = [bits](const Code &code) { return code.code >> (code.length - bits); };
+    std::sort(longCodes.begin(), longCodes.end(), [&prefixOf](const Code &lhs, const Code &rhs) { return prefixOf(lhs) < prefixOf(rhs); });
+    for (auto group = longCodes.begin(); group != longCodes.end();) {
+        const auto prefix = prefixOf(*group);
+        const auto groupEnd = std::find_if(group, longCodes.end(), [&](const Code &code) { return prefixOf(code) != prefix; });
+        const auto entryIndex = offset + prefix;
+        if (m_entries[entryIndex].length) {
+            throw ConversionException("The variable-length codes are ambiguous.");
+        }
+        auto subCodes = std::vector<Code>();
+        auto maxLength = std::uint8_t();
+        for (auto code = group; code != groupEnd; ++code) {
+            const auto length = static_cast<std::uint8_t>(code->length - bits);
+            subCodes.emplace_back(Code{ code->code & ((std::uint32_t(1) << length) - 1), length, code->symbol });
+            maxLength = std::max(maxLength, length);
+        }
+        const auto subBits = std::min(maxLength, m_rootBits);
+        const auto subOffset = m_entries.size();
+        m_entries.resize(subOffset + (std::size_t(1) << subBits));
+        m_entries[entryIndex].value = static_cast<std::int32_t>(subOffset);
+        m_entries[entryIndex].length = static_cast<std::int16_t>(-subBits);
+        build(subOffset, subBits, subCodes);
+        group = groupEnd;
+    }
+}
+
+/*!
+ * \brief Decodes \a count symbols from the specified \a reader into \a symbols.
+ * \throws Throws the same exceptions as the single-symbol overload.
+ */
+void VlcTable::decode(BitReader &reader, std::int32_t *symbols, std::size_t count) const
+{
+    for (auto *const end = symbols + count; symbols != end; ++symbols) {
+        *symbols = decode(reader);
+    }
+}
+
+} // namespace CppUtilities
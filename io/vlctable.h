@@ -0,0 +1,133 @@
+#ifndef IOUTILITIES_VLCTABLE_H
+#define IOUTILITIES_VLCTABLE_H
+
+#include "./bitreader.h"
+
+#include "../conversion/conversionexception.h"
+#include "../global.h"
+
+#include <cstdint>
+#include <initializer_list>
+#include <ios>
+#include <vector>
+
+namespace CppUtilities {
+
+class CPP_UTILITIES_EXPORT VlcTable {
+public:
+    /*!
+     * \brief The Code struct specifies a variable-length code and the symbol it represents.
+     */
+    struct Code {
+        std::uint32_t code = 0; /**< the bits of the code (right-aligned) */
+        std::uint8_t length = 0; /**< the number of bits of the code (1 to 32) */
+        std::int32_t symbol = 0; /**< the symbol the code represents */
+    };
+
+    explicit VlcTable(const Code *codes, std::size_t count, std::uint8_t rootBits = defaultRootBits);
+    explicit VlcTable(std::initializer_list<Code> codes, std::uint8_t rootBits = defaultRootBits);
+    explicit VlcTable(const std::vector<Code> &codes, std::uint8_t rootBits = defaultRootBits);
+
+    std::int32_t decode(BitReader &reader) const;
+    void decode(BitReader &reader, std::int32_t *symbols, std::size_t count) const;
+    std::uint8_t rootBits() const;
+    std::size_t entryCount() const;
+
+    static constexpr std::uint8_t defaultRootBits = 9;
+
+private:
+    /*!
+     * \brief The Entry struct is an entry of a lookup table.
+     * \remarks
+     * - If length is positive, the entry resolves to the symbol value and length is the number of bits to consume
+     *   from the bits used to index the table.
+     * - If length is negative, value is the offset of a sub table indexed by the next -length bits.
+     * - If length is zero, the bits used to index the table are not a valid code.
+     */
+    struct Entry {
+        std::int32_t value = 0;
+        std::int16_t length = 0;
+    };
+
+    void build(std::size_t offset, std::uint8_t bits, std::vector<Code> &codes);
+
+    std::vector<Entry> m_entries;
+    std::uint8_t m_rootBits;
+};
+
+/*!
+ * \brief Builds lookup tables for the specified \a codes.
+ * \sa See the other overload for details.
+ */
+inline VlcTable::VlcTable(std::initializer_list<Code> codes, std::uint8_t rootBits)
+    : VlcTable(codes.begin(), codes.size(), rootBits)
+{
+}
+
+/*!
+ * \brief Builds lookup tables for the specified \a codes.
+ * \sa See the other overload for details.
+ */
+inline VlcTable::VlcTable(const std::vector<Code> &codes, std::uint8_t rootBits)
+    : VlcTable(codes.data(), codes.size(), rootBits)
+{
+}
+
+/*!
+ * \brief Returns the number of bits used to index the root table.
+ */
+inline std::uint8_t VlcTable::rootBits() const
+{
+    return m_rootBits;
+}
+
+/*!
+ * \brief Returns the number of entries of all lookup tables.
+ */
+inline std::size_t VlcTable::entryCount() const
+{
+    return m_entries.size();
+}
+
+/*!
+ * \brief Decodes the next symbol from the specified \a reader advancing it by the length of the code.
+ * \throws
+ * - Throws ConversionException if the next bits are not a valid code.
+ * - Throws std::ios_base::failure if the end of the buffer is exceeded. The reader becomes invalid in that case.
+ */
+inline std::int32_t VlcTable::decode(BitReader &reader) const
+{
+    // ensure the cache holds at least 32 bits (the maximum code length) unless the end of the buffer is reached
+    if (reader.m_cacheBits < 32) {
+        reader.refill();
+    }
+    // walk through the tables; bits beyond the end of the buffer are zero within the cache
+    auto cache = reader.m_cache;
+    auto bits = m_rootBits;
+    auto consumed = std::uint8_t();
+    for (auto offset = std::size_t();;) {
+        const auto &entry = m_entries[offset + static_cast<std::size_t>(cache >> (64 - bits))];
+        if (entry.length > 0) {
+            consumed = static_cast<std::uint8_t>(consumed + entry.length);
+            if (consumed > reader.m_cacheBits) {
+                throw std::ios_base::failure("end of buffer exceeded");
+            }
+            reader.consume(consumed);
+            return entry.value;
+        }
+        consumed = static_cast<std::uint8_t>(consumed + bits);
+        if (!entry.length) {
+            if (consumed > reader.m_cacheBits) {
+                throw std::ios_base::failure("end of buffer exceeded");
+            }
+            throw ConversionException("invalid variable-length code");
+        }
+        cache <<= bits;
+        bits = static_cast<std::uint8_t>(-entry.length);
+        offset = static_cast<std::size_t>(entry.value);
+    }
+}
+
+} // namespace CppUtilities
+
+#endif // IOUTILITIES_VLCTABLE_H
@@ -0,0 +1,75 @@
+#ifndef CPP_UTILITIES_CPU_FEATURES_PRIVATE_H
+#define CPP_UTILITIES_CPU_FEATURES_PRIVATE_H
+
+#include "../global.h"
+
+// enable kernels for x86 extensions which are selected at runtime when compiling with GCC or Clang
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__)) && !defined(CPP_UTILITIES_NO_SIMD)
+#define CPP_UTILITIES_X86_DISPATCH
+#define CPP_UTILITIES_TARGET(features) __attribute__((target(features)))
+#include <cpuid.h>
+#include <immintrin.h>
+#endif
+
+namespace CppUtilities {
+
+#ifdef CPP_UTILITIES_X86_DISPATCH
+/*!
+ * \brief Contains functions to check for CPU features at runtime.
+ * \remarks
+ * - This header is private and only used to implement functions which select a SIMD kernel at runtime.
+ * - The checks are only performed once; subsequent calls only read a static variable.
+ */
+namespace CpuFeatures {
+
+/*!
+ * \brief Returns whether the specified \a feature as understood by __builtin_cpu_supports() is supported.
+ */
+#define CPP_UTILITIES_DEFINE_CPU_FEATURE_CHECK(name, feature)                                                                                        \
+    inline bool name()                                                                                                                               \
+    {                                                                                                                                                \
+        static const bool supported = (__builtin_cpu_init(), __builtin_cpu_supports(feature));                                                       \
+        return supported;                                                                                                                            \
+    }
+
+CPP_UTILITIES_DEFINE_CPU_FEATURE_CHECK(hasSse2, "sse2")
+CPP_UTILITIES_DEFINE_CPU_FEATURE_CHECK(hasSsse3, "ssse3")
+CPP_UTILITIES_DEFINE_CPU_FEATURE_CHECK(hasSse42, "sse4.2")
+CPP_UTILITIES_DEFINE_CPU_FEATURE_CHECK(hasAvx2, "avx2")
+CPP_UTILITIES_DEFINE_CPU_FEATURE_CHECK(hasAvx512bw, "avx512bw")
+CPP_UTILITIES_DEFINE_CPU_FEATURE_CHECK(hasBmi2, "bmi2")
+CPP_UTILITIES_DEFINE_CPU_FEATURE_CHECK(hasF16c, "f16c")
+CPP_UTILITIES_DEFINE_CPU_FEATURE_CHECK(hasPclmul, "pclmul")
+
+#undef CPP_UTILITIES_DEFINE_CPU_FEATURE_CHECK
+
+/*!
+ * \brief Returns whether BMI2 is supported and PDEP/PEXT are implemented in hardware.
+ * \remarks AMD CPUs before Zen 3 (family 19h) support BMI2 but implement PDEP/PEXT in microcode taking hundreds of cycles
+ *          so kernels relying on them are slower than scalar code there.
+ */
+inline bool hasFastPext()
+{
+    static const bool fast = [] {
+        auto eax = 0u, ebx = 0u, ecx = 0u, edx = 0u;
+        if (!hasBmi2() || !__get_cpuid(0, &eax, &ebx, &ecx, &edx)) {
+            return false;
+        }
+        // check for "AuthenticAMD" and "HygonGenuine" by the first four characters of the vendor string
+        if (ebx != 0x68747541u && ebx != 0x6F677948u) {
+            return true;
+        }
+        __get_cpuid(1, &eax, &ebx, &ecx, &edx);
+        const auto baseFamily = (eax >> 8) & 0xFu;
+        const auto family = baseFamily == 0xFu ? baseFamily + ((eax >> 20) & 0xFFu) : baseFamily;
+        return family >= 0x19u;
+    }();
+    return fast;
+}
+
+} // namespace CpuFeatures
+#endif
+
+} // namespace CppUtilities
+
+#endif // CPP_UTILITIES_CPU_FEATURES_PRIVATE_H
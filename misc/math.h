@@ -7,6 +7,10 @@
 #include <cstdint>
 #include <limits>
 
+#if __cplusplus >= 202002L && __has_include(<bit>)
+#include <bit>
+#endif
+
 namespace CppUtilities {
 
 /*!
@@ -84,6 +88,37 @@ constexpr IntegralType orderModulo(const IntegralType number, const IntegralType
     return order != module ? order : 0;
 }
 
+/*!
+ * \brief Returns the number of consecutive 0 bits in \a value starting from the most significant bit.
+ * \remarks
+ * - Returns the number of bits of \a IntegralType if \a value is zero.
+ * - Behaves like std::countl_zero() (which is used if available) and otherwise uses compiler intrinsics if possible.
+ */
+template <typename IntegralType, Traits::EnableIf<std::is_integral<IntegralType>, std::is_unsigned<IntegralType>> * = nullptr>
+constexpr int countLeadingZeros(IntegralType value)
+{
+#ifdef __cpp_lib_bitops
+    return std::countl_zero(value);
+#elif defined(__GNUC__) || defined(__clang__)
+    constexpr auto digits = std::numeric_limits<IntegralType>::digits;
+    if (!value) {
+        return digits;
+    } else if constexpr (digits <= std::numeric_limits<unsigned int>::digits) {
+        return __builtin_clz(value) - (std::numeric_limits<unsigned int>::digits - digits);
+    } else if constexpr (digits <= std::numeric_limits<unsigned long>::digits) {
+        return __builtin_clzl(value) - (std::numeric_limits<unsigned long>::digits - digits);
+    } else {
+        return __builtin_clzll(value) - (std::numeric_limits<unsigned long long>::digits - digits);
+    }
+#else
+    auto count = std::numeric_limits<IntegralType>::digits;
+    for (; value; value >>= 1) {
+        --count;
+    }
+    return count;
+#endif
+}
+
 /// \brief Returns the smallest of the given items.
 template <typename T> constexpr T min(T first, T second)
 {
@@ -0,0 +1,56 @@
+#include "../io/binaryreader.h"
+#include "../io/checksum.h"
+
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace std;
+using namespace CppUtilities;
+
+/*!
+ * \brief Runs the specified \a checksum function on \a data several times and prints the best throughput.
+ */
+template <typename Function> void benchmark(const char *name, const vector<char> &data, Function checksum)
+{
+    constexpr auto iterations = 10;
+    auto best = chrono::duration<double>::max();
+    auto result = std::uint64_t();
+    for (auto i = 0; i != iterations; ++i) {
+        const auto start = chrono::steady_clock::now();
+        result = checksum(data.data(), data.size());
+        best = min<chrono::duration<double>>(best, chrono::steady_clock::now() - start);
+    }
+    cout << setw(24) << left << name << setw(8) << right << fixed << setprecision(2) << (static_cast<double>(data.size()) / best.count() / 1e9)
+         << " GB/s (" << hex << result << dec << ')' << endl;
+}
+
+int main(int argc, char **argv)
+{
+    const auto size = static_cast<std::size_t>(argc > 1 ? stoul(argv[1]) : 64) * 1024 * 1024;
+    cout << "Benchmarking checksums over " << (size / 1024 / 1024) << " MiB of random data" << endl;
+
+    auto data = vector<char>(size);
+    auto generator = mt19937_64();
+    for (auto &c : data) {
+        c = static_cast<char>(generator());
+    }
+
+    benchmark("CRC-32 (byte-wise)", data, [](const char *buffer, std::size_t length) {
+        auto crc = std::uint32_t();
+        for (const auto *i = buffer, *end = buffer + length; i != end; ++i) {
+            crc = (crc << 8) ^ BinaryReader::crc32Table[((crc >> 24) & 0xff) ^ static_cast<std::uint8_t>(*i)];
+        }
+        return crc;
+    });
+    benchmark("CRC-32 (Ogg)", data, [](const char *buffer, std::size_t length) { return Crc32::compute(buffer, length, Crc32::Variant::Ogg); });
+    benchmark("CRC-32 (ISO-HDLC)", data, [](const char *buffer, std::size_t length) { return Crc32::compute(buffer, length, Crc32::Variant::IsoHdlc); });
+    benchmark("CRC-32C", data, [](const char *buffer, std::size_t length) { return Crc32c::compute(buffer, length); });
+    benchmark("Adler-32", data, [](const char *buffer, std::size_t length) { return Adler32::compute(buffer, length); });
+    benchmark("XXH64", data, [](const char *buffer, std::size_t length) { return XxHash64::compute(buffer, length); });
+    return 0;
+}
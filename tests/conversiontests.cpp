@@ -4,14 +4,19 @@
 #include "../tests/testutils.h"
 
 using namespace CppUtilities;
+using namespace CppUtilities::Literals;
 
 #include <cppunit/TestFixture.h>
 #include <cppunit/extensions/HelperMacros.h>
 
+#include <algorithm>
+#include <cmath>
 #include <functional>
 #include <initializer_list>
+#include <limits>
 #include <random>
 #include <sstream>
+#include <vector>
 
 #ifdef CPP_UTILITIES_USE_STANDARD_FILESYSTEM
 #include <filesystem>
@@ -24,6 +29,8 @@ using namespace CPPUNIT_NS;
 // compile-time checks for binary conversion
 static_assert(toSynchsafeInt(255) == 383, "toSynchsafeInt()");
 static_assert(toNormalInt(383) == 255, "toNormalInt()");
+static_assert(toZigZagInt(-1) == 1 && toZigZagInt(1) == 2, "toZigZagInt()");
+static_assert(fromZigZagInt(3) == -2 && fromZigZagInt(0xFFFFFFFFFFFFFFFFul) == INT64_MIN, "fromZigZagInt()");
 static_assert(swapOrder(static_cast<std::uint16_t>(0xABCD)) == 0xCDAB, "swapOrder(std::uint16_t)");
 static_assert(swapOrder(static_cast<std::uint32_t>(0xABCDEF12u)) == 0x12EFCDABu, "swapOrder(std::uint32_t)");
 static_assert(swapOrder(static_cast<std::uint64_t>(0xABCDEF1234567890ul)) == 0x9078563412EFCDABul, "swapOrder(std::uint64_t)");
@@ -40,6 +47,7 @@ class ConversionTests : public TestFixture {
     CPPUNIT_TEST(testEndianness);
     CPPUNIT_TEST(testBinaryConversions);
     CPPUNIT_TEST(testSwapOrderFunctions);
+    CPPUNIT_TEST(testVarIntConversions);
     CPPUNIT_TEST(testStringEncodingConversions);
     CPPUNIT_TEST(testStringConversions);
     CPPUNIT_TEST(testStringBuilder);
@@ -59,6 +67,7 @@ public:
     void testEndianness();
     void testBinaryConversions();
     void testSwapOrderFunctions();
+    void testVarIntConversions();
     void testStringEncodingConversions();
     void testStringConversions();
     void testStringBuilder();
@@ -162,6 +171,102 @@ void ConversionTests::testBinaryConversions()
         TEST_CUSTOM_CONVERSION(getBytes24, toUInt24, BE, 0, 0xFFFFFF);
         TEST_CUSTOM_CONVERSION(getBytes24, toUInt24, LE, 0, 0xFFFFFF);
     }
+
+    // test packed 24-bit integers with enough values to cover the vectorized code paths and the scalar tail
+    char packed[19 * 3];
+    std::int32_t unpacked[19];
+    float normalized[19];
+    for (std::size_t i = 0; i != 19; ++i) {
+        BE::getBytes24(static_cast<std::uint32_t>(i * 0x0F0F0F), packed + i * 3);
+    }
+    BE::toInt24s(packed, unpacked, 19);
+    BE::toInt24s(packed, normalized, 19);
+    for (std::size_t i = 0; i != 19; ++i) {
+        const auto expected = static_cast<std::int32_t>(i * 0x0F0F0F) - (i >= 9 ? 0x1000000 : 0);
+        CPPUNIT_ASSERT_EQUAL(expected, unpacked[i]);
+        CPPUNIT_ASSERT_EQUAL(static_cast<float>(expected) / 8388608.0f, normalized[i]);
+    }
+    char repacked[19 * 3];
+    BE::getBytes24(unpacked, 19, repacked);
+    CPPUNIT_ASSERT(std::equal(std::begin(packed), std::end(packed), std::begin(repacked)));
+    LE::getBytes24(normalized, 19, repacked);
+    LE::toInt24s(repacked, unpacked, 19);
+    CPPUNIT_ASSERT_EQUAL(static_cast<std::int32_t>(18 * 0x0F0F0F) - 0x1000000, unpacked[18]);
+
+    // test half-precision floating point conversions including rounding, overflow, subnormals and NaN
+    CPPUNIT_ASSERT_EQUAL(static_cast<std::uint16_t>(0x3C00), toFloat16(1.0f));
+    CPPUNIT_ASSERT_EQUAL(static_cast<std::uint16_t>(0xC000), toFloat16(-2.0f));
+    CPPUNIT_ASSERT_EQUAL(static_cast<std::uint16_t>(0x7BFF), toFloat16(65504.0f));
+    CPPUNIT_ASSERT_EQUAL(static_cast<std::uint16_t>(0x7BFF), toFloat16(65519.0f));
+    CPPUNIT_ASSERT_EQUAL(static_cast<std::uint16_t>(0x7C00), toFloat16(65520.0f));
+    CPPUNIT_ASSERT_EQUAL(static_cast<std::uint16_t>(0x3C00), toFloat16(1.0f + 1.0f / 2048.0f));
+    CPPUNIT_ASSERT_EQUAL(static_cast<std::uint16_t>(0x3C02), toFloat16(1.0f + 3.0f / 2048.0f));
+    CPPUNIT_ASSERT_EQUAL(static_cast<std::uint16_t>(0x0001), toFloat16(1.0f / 16777216.0f));
+    CPPUNIT_ASSERT_EQUAL(static_cast<std::uint16_t>(0x8000), toFloat16(-1.0f / 67108864.0f));
+    CPPUNIT_ASSERT_EQUAL(static_cast<std::uint16_t>(0x7E00), toFloat16(numeric_limits<float>::quiet_NaN()));
+    CPPUNIT_ASSERT_EQUAL(1.0f / 16777216.0f, fromFloat16(0x0001));
+    CPPUNIT_ASSERT_EQUAL(65504.0f, fromFloat16(0x7BFF));
+    CPPUNIT_ASSERT_EQUAL(-numeric_limits<float>::infinity(), fromFloat16(0xFC00));
+    CPPUNIT_ASSERT(std::isnan(fromFloat16(0x7C01)));
+
+    // test bulk fixed point and half-precision conversions with sizes not being a multiple of the vector width
+    float floats[19], roundTripped[19];
+    std::uint16_t fixed8s[19], float16s[19];
+    std::uint32_t fixed16s[19];
+    for (std::size_t i = 0; i != 19; ++i) {
+        floats[i] = (static_cast<float>(i) - 9.0f) * 1.375f;
+    }
+    // test fixed point conversions via decode(encode(x)) being x clamped to the unsigned range (the values are exactly
+    // representable) within the vectorized code path and the scalar tail
+    toFixed8s(floats, fixed8s, 19);
+    fromFixed8s(fixed8s, roundTripped, 19);
+    for (std::size_t i = 0; i != 19; ++i) {
+        CPPUNIT_ASSERT_EQUAL(std::max(floats[i], 0.0f), roundTripped[i]);
+    }
+    CPPUNIT_ASSERT_EQUAL(static_cast<std::uint16_t>(0x0000), fixed8s[0]);
+    CPPUNIT_ASSERT_EQUAL(static_cast<std::uint16_t>(0x0C60), fixed8s[18]);
+    toFixed16s(floats, fixed16s, 19);
+    fromFixed16s(fixed16s, roundTripped, 19);
+    for (std::size_t i = 0; i != 19; ++i) {
+        CPPUNIT_ASSERT_EQUAL(std::max(floats[i], 0.0f), roundTripped[i]);
+    }
+    CPPUNIT_ASSERT_EQUAL(static_cast<std::uint32_t>(0x00000000u), fixed16s[0]);
+    CPPUNIT_ASSERT_EQUAL(static_cast<std::uint32_t>(0x000C6000u), fixed16s[18]);
+
+    // test fixed point conversions of values out of range (which saturate), negative values and NaN (which yield zero)
+    const float extremes[] = { 1e10f, -1e10f, numeric_limits<float>::quiet_NaN(), numeric_limits<float>::infinity(), 255.999f, -128.0f, 0.5f,
+        -0.5f, 1e10f, -1e10f, numeric_limits<float>::quiet_NaN() };
+    const float expectedFixed8Floats[] = { 255.99609375f, 0.0f, 0.0f, 255.99609375f, 255.99609375f, 0.0f, 0.5f, 0.0f, 255.99609375f, 0.0f, 0.0f };
+    const float expectedFixed16Floats[]
+        = { 65535.99609375f, 0.0f, 0.0f, 65535.99609375f, 255.999f, 0.0f, 0.5f, 0.0f, 65535.99609375f, 0.0f, 0.0f };
+    toFixed8s(extremes, fixed8s, 11);
+    fromFixed8s(fixed8s, roundTripped, 11);
+    for (std::size_t i = 0; i != 11; ++i) {
+        CPPUNIT_ASSERT_EQUAL(expectedFixed8Floats[i], roundTripped[i]);
+    }
+    CPPUNIT_ASSERT_EQUAL(static_cast<std::uint16_t>(0xFFFF), fixed8s[0]);
+    toFixed16s(extremes, fixed16s, 11);
+    fromFixed16s(fixed16s, roundTripped, 11);
+    for (std::size_t i = 0; i != 11; ++i) {
+        CPPUNIT_ASSERT_EQUAL(expectedFixed16Floats[i], roundTripped[i]);
+    }
+    CPPUNIT_ASSERT_EQUAL(static_cast<std::uint32_t>(0xFFFFFF00u), fixed16s[0]);
+    toFloat16s(floats, float16s, 19);
+    fromFloat16s(float16s, roundTripped, 19);
+    for (std::size_t i = 0; i != 19; ++i) {
+        CPPUNIT_ASSERT_EQUAL(toFloat16(floats[i]), float16s[i]);
+        CPPUNIT_ASSERT_EQUAL(floats[i], roundTripped[i]);
+    }
+    char float16Bytes[19 * 2];
+    BE::getFloat16Bytes(floats, 19, float16Bytes);
+    CPPUNIT_ASSERT_EQUAL(static_cast<std::uint16_t>(0xCA30), BE::toUInt16(float16Bytes));
+    CPPUNIT_ASSERT_EQUAL(floats[0], BE::toFloat16(float16Bytes));
+    BE::toFloat16s(float16Bytes, roundTripped, 19);
+    CPPUNIT_ASSERT(std::equal(std::begin(floats), std::end(floats), std::begin(roundTripped)));
+    LE::getFloat16Bytes(floats, 19, float16Bytes);
+    CPPUNIT_ASSERT_EQUAL(static_cast<std::uint16_t>(0xCA30), LE::toUInt16(float16Bytes));
+    LE::toFloat16s(float16Bytes, roundTripped, 19);
+    CPPUNIT_ASSERT(std::equal(std::begin(floats), std::end(floats), std::begin(roundTripped)));
 }
 
 /*!
@@ -172,6 +277,95 @@ void ConversionTests::testSwapOrderFunctions()
     CPPUNIT_ASSERT(swapOrder(static_cast<std::uint16_t>(0x7825)) == 0x2578);
     CPPUNIT_ASSERT(swapOrder(static_cast<std::uint32_t>(0x12345678)) == 0x78563412);
     CPPUNIT_ASSERT(swapOrder(static_cast<std::uint64_t>(0x1122334455667788)) == 0x8877665544332211);
+
+    // test array versions with sizes not being a multiple of the vector width to cover the scalar tail as well
+    std::uint16_t values16[37];
+    std::uint32_t values32[37];
+    std::uint64_t values64[37];
+    for (std::size_t i = 0; i != 37; ++i) {
+        values16[i] = static_cast<std::uint16_t>(0x0102 + i);
+        values32[i] = static_cast<std::uint32_t>(0x01020304 + i);
+        values64[i] = static_cast<std::uint64_t>(0x0102030405060708 + i);
+    }
+    swapOrder(values16, 37);
+    swapOrder(values32, 37);
+    swapOrder(values64, 37);
+    for (std::size_t i = 0; i != 37; ++i) {
+        CPPUNIT_ASSERT_EQUAL(swapOrder(static_cast<std::uint16_t>(0x0102 + i)), values16[i]);
+        CPPUNIT_ASSERT_EQUAL(swapOrder(static_cast<std::uint32_t>(0x01020304 + i)), values32[i]);
+        CPPUNIT_ASSERT_EQUAL(swapOrder(static_cast<std::uint64_t>(0x0102030405060708 + i)), values64[i]);
+    }
+    float floats[] = { 1.125f };
+    swapOrder(floats, 1);
+    CPPUNIT_ASSERT_EQUAL(1.125f, BE::toFloat32(reinterpret_cast<const char *>(floats)));
+
+    // test bulk conversions between byte buffers and arrays
+    char bytes[37 * 8];
+    std::uint64_t converted64[37];
+    std::int32_t converted32[37];
+    BE::getBytes(values64, 37, bytes);
+    for (std::size_t i = 0; i != 37; ++i) {
+        CPPUNIT_ASSERT_EQUAL(values64[i], BE::toUInt64(bytes + i * 8));
+    }
+    BE::toUInt64s(bytes, converted64, 37);
+    CPPUNIT_ASSERT(std::equal(values64, values64 + 37, converted64));
+    LE::getBytes(values16, 37, bytes);
+    for (std::size_t i = 0; i != 37; ++i) {
+        CPPUNIT_ASSERT_EQUAL(values16[i], LE::toUInt16(bytes + i * 2));
+    }
+    BE::toInt32s(bytes, converted32, 37);
+    for (std::size_t i = 0; i != 37; ++i) {
+        CPPUNIT_ASSERT_EQUAL(BE::toInt32(bytes + i * 4), converted32[i]);
+    }
+    LE::toInt32s(bytes, converted32, 37);
+    for (std::size_t i = 0; i != 37; ++i) {
+        CPPUNIT_ASSERT_EQUAL(LE::toInt32(bytes + i * 4), converted32[i]);
+    }
+    const float floatValues[] = { 1.125f, -2.5f, 1e10f };
+    float convertedFloats[3];
+    BE::getBytes(floatValues, 3, bytes);
+    CPPUNIT_ASSERT_EQUAL(-2.5f, BE::toFloat32(bytes + 4));
+    BE::toFloat32s(bytes, convertedFloats, 3);
+    CPPUNIT_ASSERT(std::equal(floatValues, floatValues + 3, convertedFloats));
+}
+
+/*!
+ * \brief Tests LEB128 and ZigZag conversions.
+ */
+void ConversionTests::testVarIntConversions()
+{
+    // test encoding
+    char buffer[10];
+    CPPUNIT_ASSERT_EQUAL(1_st, toVarUInt64(0, buffer));
+    CPPUNIT_ASSERT_EQUAL('\0', buffer[0]);
+    CPPUNIT_ASSERT_EQUAL(2_st, toVarUInt64(300, buffer));
+    CPPUNIT_ASSERT_EQUAL("\xAC\x02"s, std::string(buffer, 2));
+    CPPUNIT_ASSERT_EQUAL(10_st, toVarUInt64(std::numeric_limits<std::uint64_t>::max(), buffer));
+    CPPUNIT_ASSERT_EQUAL("\xFF\xFF\xFF\xFF\xFF\xFF\xFF\xFF\xFF\x01"s, std::string(buffer, 10));
+
+    // test batched decoding with a mix of lengths long enough to cover the vectorized code path as well
+    auto randomEngine = std::mt19937_64(42);
+    auto expectedValues = std::vector<std::uint64_t>();
+    auto encoded = std::string();
+    for (auto i = 0; i != 500; ++i) {
+        const auto value = randomEngine() >> (randomEngine() % 64);
+        expectedValues.emplace_back(i % 3 ? value & 0x7F : value);
+        encoded.append(buffer, toVarUInt64(expectedValues.back(), buffer));
+    }
+    encoded += '\x80'; // incomplete integer at the end
+    auto decodedValues = std::vector<std::uint64_t>(expectedValues.size() + 1);
+    const char *current = encoded.data(), *const end = encoded.data() + encoded.size();
+    CPPUNIT_ASSERT_EQUAL(10_st, fromVarUInt64s(current, end, decodedValues.data(), 10));
+    CPPUNIT_ASSERT_EQUAL(expectedValues.size() - 10, fromVarUInt64s(current, end, decodedValues.data() + 10, decodedValues.size() - 10));
+    CPPUNIT_ASSERT_EQUAL(static_cast<std::ptrdiff_t>(encoded.size() - 1), current - encoded.data());
+    decodedValues.pop_back();
+    CPPUNIT_ASSERT(expectedValues == decodedValues);
+
+    // test overflow
+    const auto tooLong = "\xFF\xFF\xFF\xFF\xFF\xFF\xFF\xFF\xFF\x02"s;
+    current = tooLong.data();
+    CPPUNIT_ASSERT_THROW(fromVarUInt64s(current, tooLong.data() + tooLong.size(), decodedValues.data(), 1), ConversionException);
+    CPPUNIT_ASSERT_EQUAL(tooLong.data(), current);
 }
 
 /*!
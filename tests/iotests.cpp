@@ -22,23 +22,36 @@ std::ostream &operator<<(std::ostream &out, const std::wstring &s)
 #include "../conversion/stringbuilder.h"
 
 #include "../io/ansiescapecodes.h"
+#include "../io/asyncfilereader.h"
 #include "../io/binaryreader.h"
 #include "../io/binarywriter.h"
 #include "../io/bitreader.h"
+#include "../io/bitwriter.h"
+#include "../io/bufferreader.h"
 #include "../io/buffersearch.h"
+#include "../io/checksum.h"
 #include "../io/copy.h"
+#include "../io/crc32.h"
 #include "../io/inifile.h"
+#include "../io/lsbbitreader.h"
+#include "../io/mappedfile.h"
 #include "../io/misc.h"
 #include "../io/nativefilestream.h"
 #include "../io/path.h"
+#include "../io/readaheadbuffer.h"
+#include "../io/record.h"
+#include "../io/streambitreader.h"
+#include "../io/vlctable.h"
 
 #include <cppunit/TestFixture.h>
 #include <cppunit/extensions/HelperMacros.h>
 
 #include <algorithm>
 #include <fstream>
+#include <limits>
 #include <regex>
 #include <sstream>
+#include <stdexcept>
 
 #ifdef PLATFORM_WINDOWS
 #include <cstdio>
@@ -47,6 +60,7 @@ std::ostream &operator<<(std::ostream &out, const std::wstring &s)
 #ifdef PLATFORM_UNIX
 #include <sys/fcntl.h>
 #include <sys/types.h>
+#include <unistd.h>
 #endif
 
 using namespace std;
@@ -54,6 +68,40 @@ using namespace CppUtilities;
 using namespace CppUtilities::Literals;
 using namespace CPPUNIT_NS;
 
+/*!
+ * \brief The TestRecord struct is used to test reading/writing records via RecordSchema.
+ */
+struct TestRecord {
+    enum class Kind : std::uint8_t { Audio = 1, Video = 2 };
+    char type[4];
+    std::uint32_t size;
+    std::int32_t offset;
+    std::uint64_t duration;
+    std::int64_t position;
+    std::uint32_t tagSize;
+    std::uint16_t flags;
+    Kind kind;
+    double rate;
+
+    using RecordSchema = CppUtilities::RecordSchema<BytesField<&TestRecord::type>, BigEndianField<&TestRecord::size>,
+        BigEndianField<&TestRecord::offset, 3>, BigEndianField<&TestRecord::duration, 5>, LittleEndianField<&TestRecord::position, 7>,
+        SynchsafeField<&TestRecord::tagSize>, ReservedField<2>, LittleEndianField<&TestRecord::flags>, BigEndianField<&TestRecord::kind>,
+        BigEndianField<&TestRecord::rate>>;
+};
+
+/*!
+ * \brief The NestedTestRecord struct is used to test records containing other records.
+ */
+struct NestedTestRecord {
+    std::uint16_t index;
+    TestRecord record;
+
+    using RecordSchema = CppUtilities::RecordSchema<LittleEndianField<&NestedTestRecord::index>, RecordField<&NestedTestRecord::record>>;
+};
+
+static_assert(recordSize<TestRecord> == 40, "size of TestRecord");
+static_assert(recordSize<NestedTestRecord> == 42, "size of NestedTestRecord");
+
 /*!
  * \brief The IoTests class tests classes and functions provided by the files inside the io directory.
  */
@@ -61,7 +109,15 @@ class IoTests : public TestFixture {
     CPPUNIT_TEST_SUITE(IoTests);
     CPPUNIT_TEST(testBinaryReader);
     CPPUNIT_TEST(testBinaryWriter);
+    CPPUNIT_TEST(testBufferReader);
+    CPPUNIT_TEST(testRecords);
+    CPPUNIT_TEST(testCrc32);
+    CPPUNIT_TEST(testChecksums);
     CPPUNIT_TEST(testBitReader);
+    CPPUNIT_TEST(testBitWriter);
+    CPPUNIT_TEST(testLsbBitReader);
+    CPPUNIT_TEST(testVlcTable);
+    CPPUNIT_TEST(testStreamBitReader);
     CPPUNIT_TEST(testBufferSearch);
     CPPUNIT_TEST(testPathUtilities);
     CPPUNIT_TEST(testIniFile);
@@ -69,6 +125,9 @@ class IoTests : public TestFixture {
     CPPUNIT_TEST(testCopy);
     CPPUNIT_TEST(testCopyWithNativeFileStream);
     CPPUNIT_TEST(testReadFile);
+    CPPUNIT_TEST(testMappedFile);
+    CPPUNIT_TEST(testReadAheadBuffer);
+    CPPUNIT_TEST(testAsyncFileReader);
     CPPUNIT_TEST(testWriteFile);
     CPPUNIT_TEST(testAnsiEscapeCodes);
 #ifdef CPP_UTILITIES_USE_NATIVE_FILE_BUFFER
@@ -82,7 +141,15 @@ public:
 
     void testBinaryReader();
     void testBinaryWriter();
+    void testBufferReader();
+    void testRecords();
+    void testCrc32();
+    void testChecksums();
     void testBitReader();
+    void testBitWriter();
+    void testLsbBitReader();
+    void testVlcTable();
+    void testStreamBitReader();
     void testBufferSearch();
     void testPathUtilities();
     void testIniFile();
@@ -90,6 +157,9 @@ public:
     void testCopy();
     void testCopyWithNativeFileStream();
     void testReadFile();
+    void testMappedFile();
+    void testReadAheadBuffer();
+    void testAsyncFileReader();
     void testWriteFile();
     void testAnsiEscapeCodes();
 #ifdef CPP_UTILITIES_USE_NATIVE_FILE_BUFFER
@@ -160,9 +230,80 @@ void IoTests::testBinaryReader()
     CPPUNIT_ASSERT_EQUAL("def"s, reader.readTerminatedString());
     testFile.seekg(-4, ios_base::cur);
     CPPUNIT_ASSERT_EQUAL("def"s, reader.readTerminatedString(5, 0));
+    testFile.seekg(-4, ios_base::cur);
+    auto reusedString = std::string();
+    reusedString.reserve(32);
+    const auto *const reusedStringData = reusedString.data();
+    reader.readTerminatedString(reusedString);
+    CPPUNIT_ASSERT_EQUAL("def"s, reusedString);
+    testFile.seekg(-4, ios_base::cur);
+    reader.readTerminatedString(reusedString, 2, 0);
+    CPPUNIT_ASSERT_EQUAL("de"s, reusedString);
+    reader.readString(reusedString, 2);
+    CPPUNIT_ASSERT_EQUAL("f\0"s, reusedString);
+    CPPUNIT_ASSERT_MESSAGE("capacity of string reused", reusedString.data() == reusedStringData);
     CPPUNIT_ASSERT_THROW(reader.readLengthPrefixedString(), ConversionException);
     CPPUNIT_ASSERT_MESSAGE("pos in stream not advanced on conversion error", reader.readByte() == 0);
 
+    // read strings into a reused string from a string stream
+    stringstream stringsStream(ios_base::in | ios_base::out | ios_base::binary);
+    stringsStream.write("\x83" "ABC" "foo\0bar", 11);
+    reader.setStream(&stringsStream);
+    reader.readLengthPrefixedString(reusedString);
+    CPPUNIT_ASSERT_EQUAL("ABC"s, reusedString);
+    reader.readTerminatedString(reusedString);
+    CPPUNIT_ASSERT_EQUAL("foo"s, reusedString);
+    CPPUNIT_ASSERT(stringsStream.good());
+    reader.readTerminatedString(reusedString);
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("remaining bytes returned if termination missing", "bar"s, reusedString);
+    CPPUNIT_ASSERT_MESSAGE("eof bit set if termination missing", stringsStream.eof());
+
+    // read variable length integers (decoded within the get area unless close to the end of the stream)
+    stringstream vintStream(ios_base::in | ios_base::out | ios_base::binary);
+    vintStream.write("\x1A\x45\xDF\xA3"
+                     "\x01\x00\x00\x00\x00\x00\x00\x23"
+                     "\x42\x86"
+                     "\x81"
+                     "\x40\x02"
+                     "\x00",
+        18);
+    reader.setStream(&vintStream);
+    CPPUNIT_ASSERT_EQUAL(static_cast<std::uint64_t>(0x0A45DFA3), reader.readVariableLengthUIntBE());
+    CPPUNIT_ASSERT_EQUAL(static_cast<std::uint64_t>(0x23), reader.readVariableLengthUIntBE());
+    CPPUNIT_ASSERT_EQUAL(static_cast<std::uint64_t>(0x0286), reader.readVariableLengthUIntBE());
+    CPPUNIT_ASSERT_EQUAL(static_cast<std::uint64_t>(1), reader.readVariableLengthUIntBE());
+    CPPUNIT_ASSERT_EQUAL(static_cast<std::uint64_t>(2), reader.readVariableLengthUIntBE());
+    CPPUNIT_ASSERT_THROW(reader.readVariableLengthUIntBE(), ConversionException);
+    CPPUNIT_ASSERT_EQUAL(static_cast<istream::pos_type>(17), vintStream.tellg());
+    vintStream.seekg(12);
+    CPPUNIT_ASSERT_EQUAL(static_cast<std::uint64_t>(0x8602000000000000), reader.readVariableLengthUIntLE());
+    reader.setStream(&testFile);
+
+    // track the position and determine the size without seeking
+#ifdef CPP_UTILITIES_USE_NATIVE_FILE_BUFFER
+    NativeFileStream trackedFile(testFilePath("some_data"), ios_base::in | ios_base::binary);
+#else
+    fstream trackedFile(testFilePath("some_data"), ios_base::in | ios_base::binary);
+#endif
+    reader.setStream(&trackedFile);
+    CPPUNIT_ASSERT_EQUAL(static_cast<std::uint64_t>(398), reader.size());
+    CPPUNIT_ASSERT_EQUAL(static_cast<std::uint64_t>(0), reader.position());
+    reader.readUInt64BE();
+    reader.readUInt24LE();
+    CPPUNIT_ASSERT_EQUAL(static_cast<std::uint64_t>(11), reader.position());
+    CPPUNIT_ASSERT_EQUAL(static_cast<std::uint64_t>(387), reader.remaining());
+    reader.seek(84);
+    CPPUNIT_ASSERT_EQUAL("abc"s, reader.readString(3));
+    reader.readLengthPrefixedString();
+    reader.readLengthPrefixedString();
+    reader.readTerminatedString();
+    CPPUNIT_ASSERT_EQUAL(static_cast<std::uint64_t>(trackedFile.tellg()), reader.position());
+    CPPUNIT_ASSERT_EQUAL(398 - static_cast<std::uint64_t>(trackedFile.tellg()), reader.remaining());
+    trackedFile.seekg(10);
+    reader.invalidateCache();
+    CPPUNIT_ASSERT_EQUAL(static_cast<std::uint64_t>(10), reader.position());
+    reader.setStream(&testFile);
+
     // test ownership
     reader.setStream(nullptr, true);
     reader.setStream(new fstream(), true);
@@ -267,6 +408,241 @@ void IoTests::testBinaryWriter()
         CPPUNIT_ASSERT_EQUAL_MESSAGE(argsToString("offset ", pos), asHexNumber(expected), asHexNumber(c));
     }
 
+    // test writing arrays and reading them back
+    stringstream arrayStream(ios_base::in | ios_base::out | ios_base::binary);
+    writer.setStream(&arrayStream);
+    const std::uint16_t uint16s[] = { 0x0102, 0x0304, 0x0506, 0x0708, 0x090A, 0x0B0C, 0x0D0E, 0x0F10, 0x1112, 0x1314, 0x1516 };
+    const std::int32_t int32s[] = { 0x01020304, -0x01020304, 0x05060708, -0x05060708, 0x090A0B0C };
+    const double float64s[] = { 1.625, -2.5, 1.0e100 };
+    writer.writeUInt16BE(uint16s, 11);
+    writer.writeInt32LE(int32s, 5);
+    writer.writeFloat64BE(float64s, 3);
+    writer.writeUInt16LE(uint16s, 11);
+    CPPUNIT_ASSERT_EQUAL(static_cast<std::streamoff>(11 * 2 + 5 * 4 + 3 * 8 + 11 * 2), static_cast<std::streamoff>(arrayStream.tellp()));
+    BinaryReader reader(&arrayStream);
+    CPPUNIT_ASSERT_EQUAL(static_cast<std::uint16_t>(0x0102), reader.readUInt16BE());
+    arrayStream.seekg(0);
+    std::uint16_t readUInt16s[11];
+    std::int32_t readInt32s[5];
+    double readFloat64s[3];
+    reader.readUInt16BE(readUInt16s, 11);
+    reader.readInt32LE(readInt32s, 5);
+    reader.readFloat64BE(readFloat64s, 3);
+    CPPUNIT_ASSERT(std::equal(std::begin(uint16s), std::end(uint16s), std::begin(readUInt16s)));
+    CPPUNIT_ASSERT(std::equal(std::begin(int32s), std::end(int32s), std::begin(readInt32s)));
+    CPPUNIT_ASSERT(std::equal(std::begin(float64s), std::end(float64s), std::begin(readFloat64s)));
+    CPPUNIT_ASSERT_EQUAL(static_cast<std::uint16_t>(0x0102), reader.readUInt16LE());
+
+    // test packed 24-bit samples exceeding the chunk size
+    stringstream pcmStream(ios_base::in | ios_base::out | ios_base::binary);
+    writer.setStream(&pcmStream);
+    auto samples = std::vector<std::int32_t>(1500);
+    for (std::size_t i = 0; i != samples.size(); ++i) {
+        samples[i] = static_cast<std::int32_t>(i * 11171) % 0x800000 * (i % 2 ? -1 : 1);
+    }
+    const float floatSamples[] = { 0.0f, 0.5f, -0.25f, -1.0f, 1.0f, 1.5f, -2.0f };
+    writer.writeInt24LE(samples.data(), samples.size());
+    writer.writeInt24BE(floatSamples, 7);
+    CPPUNIT_ASSERT_EQUAL(static_cast<std::streamoff>(1507 * 3), static_cast<std::streamoff>(pcmStream.tellp()));
+    CPPUNIT_ASSERT_EQUAL("\x5D\xD4\xFF"s, pcmStream.str().substr(3, 3));
+    reader.setStream(&pcmStream);
+    auto readSamples = std::vector<std::int32_t>(samples.size());
+    float readFloatSamples[7];
+    reader.readInt24LE(readSamples.data(), readSamples.size());
+    reader.readInt24BE(readFloatSamples, 7);
+    CPPUNIT_ASSERT(samples == readSamples);
+    CPPUNIT_ASSERT_EQUAL(0.5f, readFloatSamples[1]);
+    CPPUNIT_ASSERT_EQUAL(-0.25f, readFloatSamples[2]);
+    CPPUNIT_ASSERT_EQUAL(-1.0f, readFloatSamples[3]);
+    CPPUNIT_ASSERT_EQUAL(8388607.0f / 8388608.0f, readFloatSamples[4]);
+    CPPUNIT_ASSERT_EQUAL(8388607.0f / 8388608.0f, readFloatSamples[5]);
+    CPPUNIT_ASSERT_EQUAL(-1.0f, readFloatSamples[6]);
+
+    // test reading packed 24-bit samples from a truncated stream (only complete samples are stored)
+    stringstream truncatedPcmStream("\x01\x02\x03\x04\x05\x06\x07\x08"s, ios_base::in | ios_base::binary);
+    reader.setStream(&truncatedPcmStream);
+    std::int32_t truncatedSamples[4] = { -1, -1, -1, -1 };
+    reader.readInt24BE(truncatedSamples, 4);
+    CPPUNIT_ASSERT(truncatedPcmStream.fail());
+    CPPUNIT_ASSERT_EQUAL(0x010203, truncatedSamples[0]);
+    CPPUNIT_ASSERT_EQUAL(0x040506, truncatedSamples[1]);
+    CPPUNIT_ASSERT_EQUAL(-1, truncatedSamples[2]);
+    CPPUNIT_ASSERT_EQUAL(-1, truncatedSamples[3]);
+
+    // test half-precision floating point values exceeding the chunk size
+    stringstream float16Stream(ios_base::in | ios_base::out | ios_base::binary);
+    writer.setStream(&float16Stream);
+    auto halves = std::vector<float>(2500);
+    for (std::size_t i = 0; i != halves.size(); ++i) {
+        halves[i] = static_cast<float>(i % 1024) * (i % 2 ? -0.25f : 0.5f);
+    }
+    writer.writeFloat16BE(1.5f);
+    writer.writeFloat16LE(-0.375f);
+    writer.writeFloat16BE(halves.data(), halves.size());
+    writer.writeFloat16LE(halves.data(), halves.size());
+    CPPUNIT_ASSERT_EQUAL(static_cast<std::streamoff>(2 + 2 + 5000 * 2), static_cast<std::streamoff>(float16Stream.tellp()));
+    CPPUNIT_ASSERT_EQUAL("\x3E\x00\x00\xB6"s, float16Stream.str().substr(0, 4));
+    reader.setStream(&float16Stream);
+    auto readHalves = std::vector<float>(halves.size());
+    CPPUNIT_ASSERT_EQUAL(1.5f, reader.readFloat16BE());
+    CPPUNIT_ASSERT_EQUAL(-0.375f, reader.readFloat16LE());
+    reader.readFloat16BE(readHalves.data(), readHalves.size());
+    CPPUNIT_ASSERT(halves == readHalves);
+    reader.readFloat16LE(readHalves.data(), readHalves.size());
+    CPPUNIT_ASSERT(halves == readHalves);
+
+    // test reading half-precision floating point values from a truncated stream (only complete values are stored)
+    stringstream truncatedFloat16Stream("\x00\x3C\x00\xC0\x00"s, ios_base::in | ios_base::binary);
+    reader.setStream(&truncatedFloat16Stream);
+    float truncatedHalves[3] = { 42.0f, 42.0f, 42.0f };
+    reader.readFloat16LE(truncatedHalves, 3);
+    CPPUNIT_ASSERT(truncatedFloat16Stream.fail());
+    CPPUNIT_ASSERT_EQUAL(1.0f, truncatedHalves[0]);
+    CPPUNIT_ASSERT_EQUAL(-2.0f, truncatedHalves[1]);
+    CPPUNIT_ASSERT_EQUAL(42.0f, truncatedHalves[2]);
+
+    // test write buffer
+    stringstream bufferedStream(ios_base::in | ios_base::out | ios_base::binary);
+    writer.setStream(&bufferedStream);
+    writer.setWriteBufferSize(16);
+    CPPUNIT_ASSERT_EQUAL(16_st, writer.writeBufferSize());
+    writer.writeUInt32BE(0x01020304u);
+    writer.writeUInt16LE(0x0102u);
+    writer.writeVariableLengthUIntBE(2);
+    CPPUNIT_ASSERT_EQUAL(7_st, writer.bufferedBytes());
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("data buffered within writer", 0_st, bufferedStream.str().size());
+    writer.writeUInt64BE(0x0102030405060708u);
+    writer.writeUInt16BE(0x0102u);
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("buffer drained when full", 15_st, bufferedStream.str().size());
+    CPPUNIT_ASSERT_EQUAL(2_st, writer.bufferedBytes());
+    writer.writeString("a string exceeding the write buffer");
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("big data written directly", 0_st, writer.bufferedBytes());
+    writer.writeByte(0x42);
+    writer.flush();
+    CPPUNIT_ASSERT_EQUAL("\x01\x02\x03\x04\x02\x01\x82\x01\x02\x03\x04\x05\x06\x07\x08\x01\x02"
+                         "a string exceeding the write buffer\x42"s,
+        bufferedStream.str());
+    writer.writeByte(0x43);
+    writer.setStream(&arrayStream);
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("buffer drained when stream is changed", 'C', bufferedStream.str().back());
+    {
+        auto scopedWriter = BinaryWriter(&bufferedStream);
+        scopedWriter.setWriteBufferSize(8);
+        scopedWriter.writeByte(0x44);
+        CPPUNIT_ASSERT_EQUAL('C', bufferedStream.str().back());
+    }
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("buffer drained on destruction", 'D', bufferedStream.str().back());
+    {
+        auto bufferedWriter = BinaryWriter(&bufferedStream);
+        bufferedWriter.setWriteBufferSize(8);
+        bufferedWriter.writeByte(0x45);
+        const auto copiedWriter = BinaryWriter(bufferedWriter);
+        CPPUNIT_ASSERT_EQUAL_MESSAGE("buffer of original not drained when copying", 'D', bufferedStream.str().back());
+        CPPUNIT_ASSERT_EQUAL(1_st, bufferedWriter.bufferedBytes());
+        CPPUNIT_ASSERT_EQUAL(0_st, copiedWriter.writeBufferSize());
+        bufferedWriter.flushWriteBuffer();
+        auto copy = copiedWriter;
+        copy.writeByte(0x46);
+        CPPUNIT_ASSERT_EQUAL_MESSAGE("copy does not buffer", "EF"s, bufferedStream.str().substr(bufferedStream.str().size() - 2));
+    }
+    writer.setWriteBufferSize(0);
+
+    // test LEB128/ZigZag encoded integers against BinaryReader
+    stringstream varIntStream(ios_base::in | ios_base::out | ios_base::binary);
+    writer.setStream(&varIntStream);
+    writer.writeVarUInt64(0);
+    writer.writeVarUInt64(127);
+    writer.writeVarUInt64(300);
+    writer.writeVarUInt64(numeric_limits<std::uint64_t>::max());
+    writer.writeVarInt64(-1);
+    writer.writeVarInt64(numeric_limits<std::int64_t>::min());
+    writer.writeVarInt64(63);
+    CPPUNIT_ASSERT_EQUAL("\x00\x7F\xAC\x02\xFF\xFF\xFF\xFF\xFF\xFF\xFF\xFF\xFF\x01"
+                         "\x01\xFF\xFF\xFF\xFF\xFF\xFF\xFF\xFF\xFF\x01\x7E"s,
+        varIntStream.str());
+    varIntStream.write("\x80\x80\x80\x80\x80\x80\x80\x80\x80\x7F", 10);
+    BinaryReader varIntReader(&varIntStream);
+    CPPUNIT_ASSERT_EQUAL(static_cast<std::uint64_t>(0), varIntReader.readVarUInt64());
+    CPPUNIT_ASSERT_EQUAL(static_cast<std::uint64_t>(127), varIntReader.readVarUInt64());
+    CPPUNIT_ASSERT_EQUAL(static_cast<std::uint64_t>(300), varIntReader.readVarUInt64());
+    CPPUNIT_ASSERT_EQUAL(numeric_limits<std::uint64_t>::max(), varIntReader.readVarUInt64());
+    CPPUNIT_ASSERT_EQUAL(static_cast<std::int64_t>(-1), varIntReader.readVarInt64());
+    CPPUNIT_ASSERT_EQUAL(numeric_limits<std::int64_t>::min(), varIntReader.readVarInt64());
+    CPPUNIT_ASSERT_EQUAL(static_cast<std::int64_t>(63), varIntReader.readVarInt64());
+    CPPUNIT_ASSERT_THROW(varIntReader.readVarUInt64(), ConversionException);
+    varIntStream.clear();
+    varIntStream.str("\x80\x80"s);
+    CPPUNIT_ASSERT_THROW(varIntReader.readVarUInt64(), std::ios_base::failure);
+    CPPUNIT_ASSERT_MESSAGE("fail bit set if integer is truncated", varIntStream.fail());
+    varIntStream.clear();
+    varIntStream.str("\x2A\xAC"s);
+    CPPUNIT_ASSERT_EQUAL(static_cast<std::int64_t>(21), varIntReader.readVarInt64());
+    CPPUNIT_ASSERT_THROW(varIntReader.readVarInt64(), std::ios_base::failure);
+    varIntStream.clear();
+    varIntStream.str(std::string());
+    CPPUNIT_ASSERT_THROW(varIntReader.readVarUInt64(), std::ios_base::failure);
+    writer.setStream(nullptr);
+
+    // test gather writes (falling back to sequential writes and via writev() when writing to a NativeFileStream)
+    const auto payload = std::string(5000, 'p');
+    const auto gatheredData = "head"s + payload + "\0\0\0"s + "tail";
+    stringstream gatherStream(ios_base::in | ios_base::out | ios_base::binary);
+    writer.setStream(&gatherStream);
+    writer.writeGather({ "head"sv, payload, std::string_view("\0\0\0", 3), std::string_view() });
+    writer.writeString("tail");
+    CPPUNIT_ASSERT_EQUAL(gatheredData, gatherStream.str());
+#ifdef CPP_UTILITIES_USE_NATIVE_FILE_BUFFER
+    const auto gatherPath = workingCopyPath("gather.bin", WorkingCopyMode::NoCopy);
+    {
+        auto gatherFile = NativeFileStream(gatherPath, ios_base::out | ios_base::trunc | ios_base::binary);
+        writer.setStream(&gatherFile);
+        writer.writeString("h");
+        writer.setWriteBufferSize(16);
+        writer.writeString("ea");
+        writer.writeGather({ std::string_view("d"), payload, std::string_view("\0\0\0", 3) });
+        CPPUNIT_ASSERT_EQUAL(static_cast<ostream::pos_type>(5007), gatherFile.tellp());
+        writer.writeString("tail");
+        writer.flush();
+        writer.setWriteBufferSize(0);
+        writer.setStream(nullptr);
+    }
+    CPPUNIT_ASSERT_EQUAL(gatheredData, readFile(gatherPath));
+#endif
+
+    // test placeholders resolved within the write buffer and after the write buffer has been drained
+    const auto placeholderTest = [&writer](std::ostream &stream) {
+        writer.setStream(&stream);
+        writer.setWriteBufferSize(16);
+        writer.writeByte(0x01);
+        const auto outer = writer.reserveUIntBE(4);
+        const auto inner = writer.reserveVariableLengthUIntBE(2);
+        writer.writeString("abc");
+        CPPUNIT_ASSERT_EQUAL(static_cast<std::uint64_t>(10), writer.writtenBytes());
+        writer.resolvePlaceholder(inner, writer.writtenBytes() - inner.offset - inner.size);
+        writer.writeString(std::string(20, 'x'));
+        const auto trailing = writer.reserveUIntLE(3);
+        writer.resolvePlaceholder(outer, writer.writtenBytes() - outer.offset);
+        writer.resolvePlaceholder(trailing, 0x010203);
+        CPPUNIT_ASSERT_THROW(writer.resolvePlaceholder(trailing, 0x01000000), ConversionException);
+        CPPUNIT_ASSERT_THROW(writer.resolvePlaceholder(inner, 0x4000), ConversionException);
+        CPPUNIT_ASSERT_THROW(writer.reserveUIntBE(9), ConversionException);
+        writer.flush();
+        writer.setWriteBufferSize(0);
+        writer.setStream(nullptr);
+    };
+    const auto placeholderData = "\x01\x00\x00\x00\x20\x40\x03"s + "abc" + std::string(20, 'x') + "\x03\x02\x01";
+    stringstream placeholderStream(ios_base::in | ios_base::out | ios_base::binary);
+    placeholderTest(placeholderStream);
+    CPPUNIT_ASSERT_EQUAL(placeholderData, placeholderStream.str());
+#ifdef CPP_UTILITIES_USE_NATIVE_FILE_BUFFER
+    const auto placeholderPath = workingCopyPath("placeholder.bin", WorkingCopyMode::NoCopy);
+    {
+        auto placeholderFile = NativeFileStream(placeholderPath, ios_base::out | ios_base::trunc | ios_base::binary);
+        placeholderTest(placeholderFile);
+    }
+    CPPUNIT_ASSERT_EQUAL(placeholderData, readFile(placeholderPath));
+#endif
+
     // test ownership
     writer.setStream(nullptr, true);
     writer.setStream(new fstream(), true);
@@ -277,6 +653,254 @@ void IoTests::testBinaryWriter()
     writer.setStream(new fstream(), true);
 }
 
+/*!
+ * \brief Tests the BufferReader class.
+ */
+void IoTests::testBufferReader()
+{
+    const auto testData = readFile(testFilePath("some_data"));
+    BufferReader reader(testData);
+    CPPUNIT_ASSERT_EQUAL(398_st, reader.size());
+    CPPUNIT_ASSERT_EQUAL(static_cast<std::uint16_t>(0x0102u), reader.readUInt16LE());
+    CPPUNIT_ASSERT_EQUAL(396_st, reader.remainingBytes());
+    CPPUNIT_ASSERT_EQUAL(static_cast<std::uint16_t>(0x0102u), reader.readUInt16BE());
+    CPPUNIT_ASSERT_EQUAL(0x010203u, reader.readUInt24LE());
+    CPPUNIT_ASSERT_EQUAL(0x010203u, reader.readUInt24BE());
+    CPPUNIT_ASSERT_EQUAL(0x01020304u, reader.readUInt32LE());
+    CPPUNIT_ASSERT_EQUAL(0x01020304u, reader.readUInt32BE());
+    CPPUNIT_ASSERT_EQUAL(0x0102030405u, reader.readUInt40LE());
+    CPPUNIT_ASSERT_EQUAL(0x0102030405u, reader.readUInt40BE());
+    CPPUNIT_ASSERT_EQUAL(0x01020304050607u, reader.readUInt56LE());
+    CPPUNIT_ASSERT_EQUAL(0x01020304050607u, reader.readUInt56BE());
+    CPPUNIT_ASSERT_EQUAL(0x0102030405060708u, reader.readUInt64LE());
+    CPPUNIT_ASSERT_EQUAL(0x0102030405060708u, reader.readUInt64BE());
+    reader.seek(0);
+    CPPUNIT_ASSERT_EQUAL(static_cast<std::int16_t>(0x0102), reader.readInt16LE());
+    CPPUNIT_ASSERT_EQUAL(static_cast<std::int16_t>(0x0102), reader.readInt16BE());
+    CPPUNIT_ASSERT_EQUAL(0x010203, reader.readInt24LE());
+    CPPUNIT_ASSERT_EQUAL(0x010203, reader.readInt24BE());
+    CPPUNIT_ASSERT_EQUAL(0x01020304, reader.readInt32LE());
+    CPPUNIT_ASSERT_EQUAL(0x01020304, reader.readInt32BE());
+    CPPUNIT_ASSERT_EQUAL(0x0102030405, reader.readInt40LE());
+    CPPUNIT_ASSERT_EQUAL(0x0102030405, reader.readInt40BE());
+    CPPUNIT_ASSERT_EQUAL(0x01020304050607, reader.readInt56LE());
+    CPPUNIT_ASSERT_EQUAL(0x01020304050607, reader.readInt56BE());
+    CPPUNIT_ASSERT_EQUAL(0x0102030405060708, reader.readInt64LE());
+    CPPUNIT_ASSERT_EQUAL(0x0102030405060708, reader.readInt64BE());
+    CPPUNIT_ASSERT_EQUAL(1.125f, reader.readFloat32LE());
+    CPPUNIT_ASSERT_EQUAL(1.625, reader.readFloat64LE());
+    CPPUNIT_ASSERT_EQUAL(1.125f, reader.readFloat32BE());
+    CPPUNIT_ASSERT_EQUAL(1.625, reader.readFloat64BE());
+    CPPUNIT_ASSERT_EQUAL(false, reader.readBool());
+    CPPUNIT_ASSERT_EQUAL(true, reader.readBool());
+    CPPUNIT_ASSERT_EQUAL("abc"sv, reader.readView(3));
+    CPPUNIT_ASSERT_EQUAL("ABC"s, reader.readLengthPrefixedString());
+    CPPUNIT_ASSERT_EQUAL(300_st, reader.readLengthPrefixedString().size());
+    CPPUNIT_ASSERT_EQUAL("def"s, reader.readTerminatedString());
+    reader.seek(reader.position() - 4);
+    CPPUNIT_ASSERT_EQUAL("def"s, reader.readTerminatedString(5, 0));
+    const auto posBeforeError = reader.position();
+    CPPUNIT_ASSERT_THROW(reader.readLengthPrefixedString(), ConversionException);
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("pos not advanced on conversion error", posBeforeError, reader.position());
+    CPPUNIT_ASSERT_EQUAL(static_cast<std::uint8_t>(0), reader.readByte());
+
+    // test bounds checking
+    reader.seek(reader.size() - 2);
+    CPPUNIT_ASSERT_THROW(reader.readUInt24BE(), std::ios_base::failure);
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("pos not advanced when end of buffer exceeded", 2_st, reader.remainingBytes());
+    reader.skip(2);
+    CPPUNIT_ASSERT(!reader.canRead());
+    CPPUNIT_ASSERT_THROW(reader.readByte(), std::ios_base::failure);
+    CPPUNIT_ASSERT_THROW(reader.seek(reader.size() + 1), std::ios_base::failure);
+
+    // test variable-length integers and CRC-32 against BinaryReader
+    const char vints[] = { '\x81', '\x40', '\x02', '\x10', '\x00', '\x00', '\x01' };
+    reader.reset(vints, sizeof(vints));
+    CPPUNIT_ASSERT_EQUAL(static_cast<std::uint64_t>(1), reader.readVariableLengthUIntBE());
+    CPPUNIT_ASSERT_EQUAL(static_cast<std::uint64_t>(2), reader.readVariableLengthUIntBE());
+    CPPUNIT_ASSERT_EQUAL(static_cast<std::uint64_t>(1), reader.readVariableLengthUIntBE());
+    CPPUNIT_ASSERT(!reader.canRead());
+    const char vintSequence[] = { '\x1A', '\x45', '\xDF', '\xA3', '\x01', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x23', '\x42', '\x86', '\x81',
+        '\x40', '\x02' };
+    std::uint64_t decodedVints[6] = {};
+    reader.reset(vintSequence, sizeof(vintSequence));
+    CPPUNIT_ASSERT_EQUAL(static_cast<std::uint64_t>(0x0A45DFA3), reader.readVariableLengthUIntBE());
+    CPPUNIT_ASSERT_EQUAL(static_cast<std::uint64_t>(0x23), reader.readVariableLengthUIntBE());
+    reader.reset(vintSequence, sizeof(vintSequence));
+    CPPUNIT_ASSERT_EQUAL(5_st, reader.readVariableLengthUIntsBE(decodedVints, 6));
+    const std::uint64_t expectedVints[] = { 0x0A45DFA3, 0x23, 0x0286, 1, 2 };
+    CPPUNIT_ASSERT(std::equal(std::begin(expectedVints), std::end(expectedVints), decodedVints));
+    CPPUNIT_ASSERT(!reader.canRead());
+    reader.reset(vintSequence, sizeof(vintSequence));
+    CPPUNIT_ASSERT_EQUAL(2_st, reader.readVariableLengthUIntsBE(decodedVints, 2));
+    CPPUNIT_ASSERT_EQUAL(12_st, reader.position());
+    const char invalidVints[] = { '\x81', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x81', '\x40' };
+    reader.reset(invalidVints, sizeof(invalidVints));
+    CPPUNIT_ASSERT_THROW(reader.readVariableLengthUIntsBE(decodedVints, 6), ConversionException);
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("position left after last valid integer", 1_st, reader.position());
+    reader.seek(9);
+    CPPUNIT_ASSERT_THROW(reader.readVariableLengthUIntsBE(decodedVints, 6), std::ios_base::failure);
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("position left after last complete integer", 10_st, reader.position());
+
+    // test LEB128/ZigZag encoded integers
+    const char varInts[] = { '\xAC', '\x02', '\x03', '\x7F', '\x80' };
+    reader.reset(varInts, sizeof(varInts));
+    CPPUNIT_ASSERT_EQUAL(static_cast<std::uint64_t>(300), reader.readVarUInt64());
+    CPPUNIT_ASSERT_EQUAL(static_cast<std::int64_t>(-2), reader.readVarInt64());
+    CPPUNIT_ASSERT_THROW(reader.readVarUInt64s(decodedVints, 6), std::ios_base::failure);
+    CPPUNIT_ASSERT_EQUAL(static_cast<std::uint64_t>(0x7F), decodedVints[0]);
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("position left at truncated integer", 4_st, reader.position());
+    CPPUNIT_ASSERT_THROW(reader.readVarUInt64(), std::ios_base::failure);
+    reader.reset(varInts, 3);
+    CPPUNIT_ASSERT_EQUAL(2_st, reader.readVarUInt64s(decodedVints, 6));
+    CPPUNIT_ASSERT(!reader.canRead());
+    reader.reset(testData.data(), testData.size());
+    CPPUNIT_ASSERT_EQUAL(BinaryReader::computeCrc32(testData.data(), testData.size()), reader.readCrc32(testData.size()));
+}
+
+/*!
+ * \brief Tests reading/writing records via BinaryReader::readRecord() and BinaryWriter::writeRecord().
+ */
+void IoTests::testRecords()
+{
+    auto record = TestRecord{ { 'f', 't', 'y', 'p' }, 0x01020304, -2, 0x0102030405, -0x010203, 255, 0x0102, TestRecord::Kind::Video, 1.5 };
+    stringstream stream(ios_base::in | ios_base::out | ios_base::binary);
+    stream.exceptions(ios_base::failbit | ios_base::badbit);
+    BinaryWriter writer(&stream);
+    BinaryReader reader(&stream);
+
+    // test single record
+    writer.writeRecord(record);
+    CPPUNIT_ASSERT_EQUAL("ftyp\x01\x02\x03\x04\xFF\xFF\xFE\x01\x02\x03\x04\x05\xFD\xFD\xFE\xFF\xFF\xFF\xFF\x00\x00\x01\x7F\x00\x00"
+                         "\x02\x01\x02\x3F\xF8\x00\x00\x00\x00\x00\x00"s,
+        stream.str());
+    const auto readRecord = reader.readRecord<TestRecord>();
+    CPPUNIT_ASSERT_EQUAL("ftyp"s, std::string(readRecord.type, sizeof(readRecord.type)));
+    CPPUNIT_ASSERT_EQUAL(record.size, readRecord.size);
+    CPPUNIT_ASSERT_EQUAL(record.offset, readRecord.offset);
+    CPPUNIT_ASSERT_EQUAL(record.duration, readRecord.duration);
+    CPPUNIT_ASSERT_EQUAL(record.position, readRecord.position);
+    CPPUNIT_ASSERT_EQUAL(record.tagSize, readRecord.tagSize);
+    CPPUNIT_ASSERT_EQUAL(record.flags, readRecord.flags);
+    CPPUNIT_ASSERT(record.kind == readRecord.kind);
+    CPPUNIT_ASSERT_EQUAL(record.rate, readRecord.rate);
+
+    // test arrays of (nested) records exceeding the chunk size
+    auto records = std::vector<NestedTestRecord>(250);
+    for (std::size_t i = 0; i != records.size(); ++i) {
+        records[i].index = static_cast<std::uint16_t>(i);
+        records[i].record = record;
+        records[i].record.duration = i;
+        records[i].record.offset = -static_cast<std::int32_t>(i);
+    }
+    stream.str(std::string());
+    writer.writeRecords(records.data(), records.size());
+    CPPUNIT_ASSERT_EQUAL(records.size() * 42, stream.str().size());
+    auto readRecords = std::vector<NestedTestRecord>(records.size());
+    reader.readRecords(readRecords.data(), readRecords.size());
+    for (std::size_t i = 0; i != records.size(); ++i) {
+        CPPUNIT_ASSERT_EQUAL(records[i].index, readRecords[i].index);
+        CPPUNIT_ASSERT_EQUAL(records[i].record.duration, readRecords[i].record.duration);
+        CPPUNIT_ASSERT_EQUAL(records[i].record.offset, readRecords[i].record.offset);
+        CPPUNIT_ASSERT_EQUAL(records[i].record.position, readRecords[i].record.position);
+    }
+    CPPUNIT_ASSERT_THROW(reader.readRecord<TestRecord>(), std::ios_base::failure);
+}
+
+/*!
+ * \brief Tests the Crc32 class.
+ */
+void IoTests::testCrc32()
+{
+    // test check values of all variants
+    CPPUNIT_ASSERT_EQUAL(0x89A1897Fu, Crc32::compute("123456789"sv));
+    CPPUNIT_ASSERT_EQUAL(0x0376E6E7u, Crc32::compute("123456789"sv, Crc32::Variant::Mpeg2));
+    CPPUNIT_ASSERT_EQUAL(0xFC891918u, Crc32::compute("123456789"sv, Crc32::Variant::Bzip2));
+    CPPUNIT_ASSERT_EQUAL(0xCBF43926u, Crc32::compute("123456789"sv, Crc32::Variant::IsoHdlc));
+    CPPUNIT_ASSERT_EQUAL(0xE3069283u, Crc32::compute("123456789"sv, Crc32::Variant::Castagnoli));
+    CPPUNIT_ASSERT_EQUAL(0u, Crc32::compute(std::string_view()));
+
+    // test bigger blocks (which might be folded via carry-less multiplication) against the byte-wise table
+    auto testData = std::string(1000, '\0');
+    for (std::size_t i = 0; i != testData.size(); ++i) {
+        testData[i] = static_cast<char>((i * 7) ^ (i >> 3));
+    }
+    auto expectedCrc = std::uint32_t();
+    for (const auto c : testData) {
+        expectedCrc = (expectedCrc << 8) ^ BinaryReader::crc32Table[((expectedCrc >> 24) & 0xff) ^ static_cast<std::uint8_t>(c)];
+    }
+    CPPUNIT_ASSERT_EQUAL(expectedCrc, Crc32::compute(testData));
+    CPPUNIT_ASSERT_EQUAL(expectedCrc, BinaryReader::computeCrc32(testData.data(), testData.size()));
+
+    // test incremental updates with odd chunk sizes
+    auto crc = Crc32(Crc32::Variant::IsoHdlc);
+    for (std::size_t offset = 0, chunkSize = 1; offset < testData.size(); offset += chunkSize, chunkSize = chunkSize * 3 + 1) {
+        crc.update(std::string_view(testData).substr(offset, chunkSize));
+    }
+    CPPUNIT_ASSERT_EQUAL(Crc32::compute(testData, Crc32::Variant::IsoHdlc), crc.finalize());
+    crc.reset();
+    crc.update("123456789"sv);
+    CPPUNIT_ASSERT_EQUAL(0xCBF43926u, crc.finalize());
+
+    // test reading blocks via BinaryReader
+    stringstream stream(ios_base::in | ios_base::out | ios_base::binary);
+    for (auto i = 0; i != 10; ++i) {
+        stream.write(testData.data(), static_cast<streamsize>(testData.size()));
+    }
+    auto reader = BinaryReader(&stream);
+    crc = Crc32();
+    for (auto i = 0; i != 10; ++i) {
+        crc.update(testData);
+    }
+    CPPUNIT_ASSERT_EQUAL(crc.finalize(), reader.readCrc32(10 * testData.size()));
+    CPPUNIT_ASSERT_EQUAL(static_cast<istream::pos_type>(10 * testData.size()), stream.tellg());
+}
+
+/*!
+ * \brief Tests the Crc32c, Adler32 and XxHash64 classes.
+ */
+void IoTests::testChecksums()
+{
+    // test known values
+    CPPUNIT_ASSERT_EQUAL(0xE3069283u, Crc32c::compute("123456789"sv));
+    CPPUNIT_ASSERT_EQUAL(0x11E60398u, Adler32::compute("Wikipedia"sv));
+    CPPUNIT_ASSERT_EQUAL(1u, Adler32::compute(std::string_view()));
+    CPPUNIT_ASSERT_EQUAL(0xEF46DB3751D8E999ull, static_cast<unsigned long long>(XxHash64::compute(std::string_view())));
+    CPPUNIT_ASSERT_EQUAL(0x44BC2CF5AD770999ull, static_cast<unsigned long long>(XxHash64::compute("abc"sv)));
+    CPPUNIT_ASSERT_EQUAL(
+        0xFBCEA83C8A378BF1ull, static_cast<unsigned long long>(XxHash64::compute("Nobody inspects the spammish repetition"sv)));
+
+    // test Adler-32 on data exceeding the size up to which the modulo can be deferred against a straight-forward implementation
+    auto testData = std::string(12000, '\xFF');
+    for (std::size_t i = 0; i < testData.size(); i += 3) {
+        testData[i] = static_cast<char>(i * 13);
+    }
+    auto a = std::uint32_t(1), b = std::uint32_t(0);
+    for (const auto c : testData) {
+        a = (a + static_cast<std::uint8_t>(c)) % 65521;
+        b = (b + a) % 65521;
+    }
+    CPPUNIT_ASSERT_EQUAL((b << 16) | a, Adler32::compute(testData));
+
+    // test incremental updates with odd chunk sizes
+    auto crc32c = Crc32c();
+    auto adler32 = Adler32();
+    auto xxHash64 = XxHash64(42);
+    for (std::size_t offset = 0, chunkSize = 1; offset < testData.size(); offset += chunkSize, chunkSize = chunkSize * 2 + 1) {
+        const auto chunk = std::string_view(testData).substr(offset, chunkSize);
+        crc32c.update(chunk);
+        adler32.update(chunk);
+        xxHash64.update(chunk);
+    }
+    CPPUNIT_ASSERT_EQUAL(Crc32::compute(testData, Crc32::Variant::Castagnoli), crc32c.finalize());
+    CPPUNIT_ASSERT_EQUAL(Adler32::compute(testData), adler32.finalize());
+    CPPUNIT_ASSERT_EQUAL(XxHash64::compute(testData, 42), xxHash64.finalize());
+    CPPUNIT_ASSERT(XxHash64::compute(testData, 42) != XxHash64::compute(testData));
+    xxHash64.reset();
+    xxHash64.update("abc"sv);
+    CPPUNIT_ASSERT_EQUAL(XxHash64::compute("abc"sv, 42), xxHash64.finalize());
+}
+
 /*!
  * \brief Tests the BitReader class.
  */
@@ -302,6 +926,337 @@ void IoTests::testBitReader()
     CPPUNIT_ASSERT_THROW(reader.skipBits(1), std::ios_base::failure);
     reader.reset(reinterpret_cast<const char *>(testData), sizeof(testData));
     CPPUNIT_ASSERT_EQUAL(static_cast<std::size_t>(8 * sizeof(testData)), reader.bitsAvailable());
+
+    // test reads spanning refills of the cache and up to 64 bits at once
+    reader.align();
+    CPPUNIT_ASSERT_EQUAL(static_cast<std::size_t>(8 * sizeof(testData)), reader.bitsAvailable());
+    CPPUNIT_ASSERT_EQUAL(static_cast<std::uint8_t>(0x8), reader.readBits<std::uint8_t>(4));
+    CPPUNIT_ASSERT_EQUAL(static_cast<std::uint64_t>(0x1903C44280044102u), reader.showBits<std::uint64_t>(64));
+    CPPUNIT_ASSERT_EQUAL(static_cast<std::uint64_t>(0x1903C44280044102u), reader.readBits<std::uint64_t>(64));
+    CPPUNIT_ASSERT_EQUAL(static_cast<std::uint32_t>(0x0FFFA), reader.readBits<std::uint32_t>(20));
+    CPPUNIT_ASSERT_EQUAL(0_st, reader.bitsAvailable());
+    CPPUNIT_ASSERT_EQUAL(static_cast<std::uint8_t>(0), reader.readBits<std::uint8_t>(0));
+    CPPUNIT_ASSERT_THROW(reader.showBits<std::uint8_t>(1), std::ios_base::failure);
+    reader.reset(reinterpret_cast<const char *>(testData), sizeof(testData));
+    reader.skipBits(8 * sizeof(testData) - 3);
+    CPPUNIT_ASSERT_EQUAL(static_cast<std::uint8_t>(0x2), reader.readBits<std::uint8_t>(3));
+    reader.reset(reinterpret_cast<const char *>(testData), static_cast<std::size_t>(0));
+    CPPUNIT_ASSERT_EQUAL(0_st, reader.bitsAvailable());
+    CPPUNIT_ASSERT_THROW(reader.readBit(), std::ios_base::failure);
+
+    // test Exp-Golomb codes exceeding the cache and batch decoding
+    const std::uint8_t expGolombData[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0xE4, 0x4C, 0x85, 0x00, 0x09, 0x1A, 0x80 };
+    reader.reset(reinterpret_cast<const char *>(expGolombData), sizeof(expGolombData));
+    CPPUNIT_ASSERT_EQUAL(static_cast<std::uint64_t>(0x1FFFFFFFFFFFFu), reader.readUnsignedExpGolombCodedBits<std::uint64_t>());
+    std::uint8_t unsignedValues[5];
+    reader.readUnsignedExpGolombCodedBits(unsignedValues, 5);
+    CPPUNIT_ASSERT_EQUAL(static_cast<std::uint8_t>(0), unsignedValues[0]);
+    CPPUNIT_ASSERT_EQUAL(static_cast<std::uint8_t>(1), unsignedValues[1]);
+    CPPUNIT_ASSERT_EQUAL(static_cast<std::uint8_t>(2), unsignedValues[2]);
+    CPPUNIT_ASSERT_EQUAL(static_cast<std::uint8_t>(0), unsignedValues[3]);
+    CPPUNIT_ASSERT_EQUAL(static_cast<std::uint8_t>(3), unsignedValues[4]);
+    std::int16_t signedValues[4];
+    reader.readSignedExpGolombCodedBits(signedValues, 4);
+    CPPUNIT_ASSERT_EQUAL(static_cast<std::int16_t>(1), signedValues[0]);
+    CPPUNIT_ASSERT_EQUAL(static_cast<std::int16_t>(-1), signedValues[1]);
+    CPPUNIT_ASSERT_EQUAL(static_cast<std::int16_t>(2), signedValues[2]);
+    CPPUNIT_ASSERT_EQUAL(static_cast<std::int16_t>(-2), signedValues[3]);
+    CPPUNIT_ASSERT_EQUAL(static_cast<std::uint32_t>(0x1234), reader.readUnsignedExpGolombCodedBits<std::uint32_t>());
+    CPPUNIT_ASSERT_THROW(reader.readUnsignedExpGolombCodedBits<std::uint8_t>(), std::ios_base::failure);
+    const char zeros[9] = {};
+    reader.reset(zeros, sizeof(zeros));
+    CPPUNIT_ASSERT_THROW(reader.readUnsignedExpGolombCodedBits<std::uint64_t>(), std::ios_base::failure);
+
+    // test skipping emulation prevention bytes (payload: 25 000001 000000000000 02 AB… 000003 80 0000)
+    auto nalUnit = "\x25\x00\x00\x03\x01\x00\x00\x03\x00\x00\x03\x00\x00\x03\x02"s;
+    nalUnit.append(30, '\xAB');
+    nalUnit.append("\x00\x00\x03\x03\x80\x00\x00\x03", 8);
+    reader.reset(nalUnit.data(), nalUnit.size());
+    CPPUNIT_ASSERT(!reader.isSkippingEmulationPreventionBytes());
+    reader.setSkippingEmulationPreventionBytes(true);
+    CPPUNIT_ASSERT(reader.isSkippingEmulationPreventionBytes());
+    CPPUNIT_ASSERT_EQUAL(static_cast<std::size_t>(47 * 8), reader.bitsAvailable());
+    CPPUNIT_ASSERT_EQUAL(static_cast<std::uint8_t>(0x25), reader.readBits<std::uint8_t>(8));
+    CPPUNIT_ASSERT_EQUAL(static_cast<std::uint32_t>(0x100), reader.readBits<std::uint32_t>(32));
+    CPPUNIT_ASSERT_EQUAL(static_cast<std::uint64_t>(0x2), reader.readBits<std::uint64_t>(48));
+    reader.skipBits(29 * 8 + 4);
+    CPPUNIT_ASSERT_EQUAL(static_cast<std::uint8_t>(0xB), reader.readBits<std::uint8_t>(4));
+    CPPUNIT_ASSERT_EQUAL(static_cast<std::uint32_t>(0x380), reader.readBits<std::uint32_t>(32));
+    CPPUNIT_ASSERT_EQUAL(static_cast<std::size_t>(16), reader.bitsAvailable());
+    CPPUNIT_ASSERT_EQUAL(static_cast<std::uint16_t>(0), reader.readBits<std::uint16_t>(16));
+    CPPUNIT_ASSERT_THROW(reader.readBit(), std::ios_base::failure);
+    reader.reset(nalUnit.data(), nalUnit.size());
+    CPPUNIT_ASSERT_EQUAL(static_cast<std::size_t>(47 * 8), reader.bitsAvailable());
+    reader.setSkippingEmulationPreventionBytes(false);
+    CPPUNIT_ASSERT_EQUAL(nalUnit.size() * 8, reader.bitsAvailable());
+}
+
+/*!
+ * \brief Tests the BitWriter class.
+ */
+void IoTests::testBitWriter()
+{
+    // write into the internal buffer
+    auto writer = BitWriter();
+    writer.writeBit(true);
+    writer.writeBits(0, 6);
+    writer.writeBits(3, 2);
+    writer.writeBits(0x103C4428u << 1, 32);
+    writer.align();
+    writer.writeBits(static_cast<std::uint8_t>(0x44), 8);
+    writer.writeUnsignedExpGolombCodedBits(7u);
+    writer.writeSignedExpGolombCodedBits(4);
+    writer.writeBits(-1, 2);
+    CPPUNIT_ASSERT_EQUAL(static_cast<std::uint64_t>(72), writer.bitsWritten());
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("only whole words emitted", 8_st, writer.buffer().size());
+    writer.writeBits(0x0102030405060708u, 64);
+    CPPUNIT_ASSERT_EQUAL(16_st, writer.buffer().size());
+    writer.flush();
+    CPPUNIT_ASSERT_EQUAL(static_cast<std::uint64_t>(136), writer.bitsWritten());
+    const auto data = writer.takeBuffer();
+    CPPUNIT_ASSERT_EQUAL("\x81\x90\x3C\x44\x28\x00\x44\x10\x23\x01\x02\x03\x04\x05\x06\x07\x08"s, data);
+    CPPUNIT_ASSERT(writer.buffer().empty());
+
+    // read back the written data
+    auto reader = BitReader(data.data(), data.size());
+    CPPUNIT_ASSERT_EQUAL(static_cast<std::uint8_t>(1), reader.readBit());
+    reader.skipBits(6);
+    CPPUNIT_ASSERT_EQUAL(static_cast<std::uint8_t>(3), reader.readBits<std::uint8_t>(2));
+    CPPUNIT_ASSERT_EQUAL(static_cast<std::uint32_t>(0x103C4428u << 1), reader.readBits<std::uint32_t>(32));
+    reader.align();
+    CPPUNIT_ASSERT_EQUAL(static_cast<std::uint8_t>(0x44), reader.readBits<std::uint8_t>(8));
+    CPPUNIT_ASSERT_EQUAL(static_cast<std::uint8_t>(7), reader.readUnsignedExpGolombCodedBits<std::uint8_t>());
+    CPPUNIT_ASSERT_EQUAL(static_cast<std::int8_t>(4), reader.readSignedExpGolombCodedBits<std::int8_t>());
+    CPPUNIT_ASSERT_EQUAL(static_cast<std::uint8_t>(3), reader.readBits<std::uint8_t>(2));
+    CPPUNIT_ASSERT_EQUAL(static_cast<std::uint64_t>(0x0102030405060708u), reader.readBits<std::uint64_t>(64));
+
+    // write to a BinaryWriter
+    stringstream stream(ios_base::in | ios_base::out | ios_base::binary);
+    auto binaryWriter = BinaryWriter(&stream);
+    writer.reset(&binaryWriter);
+    CPPUNIT_ASSERT(writer.writer() == &binaryWriter);
+    writer.writeBits(0xFFF, 12);
+    writer.writeSignedExpGolombCodedBits(-2);
+    writer.flush();
+    CPPUNIT_ASSERT_EQUAL("\xFF\xF2\x80"s, stream.str());
+    CPPUNIT_ASSERT(writer.buffer().empty());
+
+    // write the extreme values which can (not) be Exp-Golomb coded
+    writer.reset(nullptr);
+    CPPUNIT_ASSERT_THROW(writer.writeUnsignedExpGolombCodedBits(std::numeric_limits<std::uint64_t>::max()), ConversionException);
+    CPPUNIT_ASSERT_THROW(writer.writeSignedExpGolombCodedBits(std::numeric_limits<std::int64_t>::min()), ConversionException);
+    CPPUNIT_ASSERT_EQUAL(static_cast<std::uint64_t>(0), writer.bitsWritten());
+    writer.writeUnsignedExpGolombCodedBits(std::numeric_limits<std::uint64_t>::max() - 1);
+    writer.writeSignedExpGolombCodedBits(std::numeric_limits<std::int64_t>::max());
+    writer.writeSignedExpGolombCodedBits(std::numeric_limits<std::int64_t>::min() + 1);
+    writer.writeSignedExpGolombCodedBits(std::numeric_limits<std::int8_t>::min());
+    writer.flush();
+    const auto extremes = writer.takeBuffer();
+    reader.reset(extremes.data(), extremes.size());
+    CPPUNIT_ASSERT_EQUAL(std::numeric_limits<std::uint64_t>::max() - 1, reader.readUnsignedExpGolombCodedBits<std::uint64_t>());
+    CPPUNIT_ASSERT_EQUAL(std::numeric_limits<std::int64_t>::max(), reader.readSignedExpGolombCodedBits<std::int64_t>());
+    CPPUNIT_ASSERT_EQUAL(std::numeric_limits<std::int64_t>::min() + 1, reader.readSignedExpGolombCodedBits<std::int64_t>());
+    CPPUNIT_ASSERT_EQUAL(std::numeric_limits<std::int8_t>::min(), reader.readSignedExpGolombCodedBits<std::int8_t>());
+}
+
+/*!
+ * \brief Tests the LsbBitReader class.
+ */
+void IoTests::testLsbBitReader()
+{
+    // start with the header of a DEFLATE block using fixed Huffman codes
+    const std::uint8_t testData[] = { 0x4B, 0x04, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C };
+    auto reader = LsbBitReader(reinterpret_cast<const char *>(testData), sizeof(testData));
+    CPPUNIT_ASSERT_EQUAL(sizeof(testData) * 8, reader.bitsAvailable());
+    CPPUNIT_ASSERT_EQUAL(static_cast<std::uint8_t>(1), reader.readBit());
+    CPPUNIT_ASSERT_EQUAL(static_cast<std::uint8_t>(1), reader.readBits<std::uint8_t>(2));
+    CPPUNIT_ASSERT_EQUAL(static_cast<std::uint8_t>(9), reader.showBits<std::uint8_t>(5));
+    CPPUNIT_ASSERT_EQUAL(static_cast<std::uint8_t>(9), reader.readBits<std::uint8_t>(5));
+    CPPUNIT_ASSERT_EQUAL(static_cast<std::uint16_t>(0x0004), reader.readBits<std::uint16_t>(16));
+    CPPUNIT_ASSERT_EQUAL(static_cast<std::uint64_t>(0x0807060504030201), reader.showBits<std::uint64_t>(64));
+    CPPUNIT_ASSERT_EQUAL(static_cast<std::uint64_t>(0x0807060504030201), reader.readBits<std::uint64_t>(64));
+    CPPUNIT_ASSERT_EQUAL(static_cast<std::uint8_t>(0x9), reader.readBits<std::uint8_t>(4));
+    CPPUNIT_ASSERT_EQUAL(static_cast<std::uint16_t>(0xA0), reader.readBits<std::uint16_t>(12));
+    reader.skipBits(3);
+    reader.align();
+    CPPUNIT_ASSERT_EQUAL(static_cast<std::size_t>(8), reader.bitsAvailable());
+    reader.align();
+    CPPUNIT_ASSERT_EQUAL(static_cast<std::uint8_t>(0x0C), reader.showBits<std::uint8_t>(8));
+    CPPUNIT_ASSERT_THROW(reader.readBits<std::uint16_t>(9), std::ios_base::failure);
+
+    // skip beyond the cache and exceed the end of the buffer via skipBits()
+    reader.reset(reinterpret_cast<const char *>(testData), sizeof(testData));
+    reader.skipBits(8 * 10 + 4);
+    CPPUNIT_ASSERT_EQUAL(static_cast<std::uint8_t>(0x0), reader.readBits<std::uint8_t>(4));
+    CPPUNIT_ASSERT_EQUAL(static_cast<std::uint8_t>(0x09), reader.readBits<std::uint8_t>(8));
+    CPPUNIT_ASSERT_THROW(reader.skipBits(25), std::ios_base::failure);
+}
+
+/*!
+ * \brief Tests the VlcTable class.
+ */
+void IoTests::testVlcTable()
+{
+    // create an incomplete set of codes with long codes requiring multiple levels of sub tables
+    const auto codes = std::vector<VlcTable::Code>{
+        { 0b0, 1, 'a' },
+        { 0b10, 2, 'b' },
+        { 0b110, 3, 'c' },
+        { 0b11100, 5, 'd' },
+        { 0b111010101, 9, 'e' },
+        { 0b1111111111111111111111111111110u, 31, 'f' },
+        { 0b11111111111111111111111111111110u, 32, 'g' },
+    };
+    auto writer = BitWriter();
+    const auto text = "abcadebgfagcdeefab"s;
+    for (const auto symbol : text) {
+        const auto &code = *std::find_if(codes.begin(), codes.end(), [symbol](const VlcTable::Code &c) { return c.symbol == symbol; });
+        writer.writeBits(code.code, code.length);
+    }
+    writer.flush();
+    const auto data = writer.takeBuffer();
+
+    // decode with different numbers of root bits
+    for (const auto rootBits : { std::uint8_t(1), std::uint8_t(3), std::uint8_t(9), std::uint8_t(16) }) {
+        const auto table = VlcTable(codes, rootBits);
+        CPPUNIT_ASSERT_EQUAL(rootBits, table.rootBits());
+        CPPUNIT_ASSERT(table.entryCount() >= (1u << rootBits));
+        auto reader = BitReader(data.data(), data.size());
+        auto decoded = std::string();
+        for (std::size_t i = 0; i != text.size(); ++i) {
+            decoded += static_cast<char>(table.decode(reader));
+        }
+        CPPUNIT_ASSERT_EQUAL(text, decoded);
+        CPPUNIT_ASSERT(reader.bitsAvailable() < 8);
+        reader.reset(data.data(), data.size());
+        std::int32_t symbols[5];
+        table.decode(reader, symbols, 5);
+        CPPUNIT_ASSERT_EQUAL(static_cast<std::int32_t>('d'), symbols[4]);
+    }
+
+    // test error handling
+    const auto table = VlcTable({ { 0b1, 1, 1 }, { 0b01, 2, 2 } }, 2);
+    const char invalid[] = { '\x3F', '\x00' };
+    auto reader = BitReader(invalid, sizeof(invalid));
+    CPPUNIT_ASSERT_THROW(table.decode(reader), ConversionException);
+    reader.reset(invalid, 1);
+    reader.skipBits(6);
+    CPPUNIT_ASSERT_EQUAL(static_cast<std::int32_t>(1), table.decode(reader));
+    CPPUNIT_ASSERT_EQUAL(static_cast<std::int32_t>(1), table.decode(reader));
+    CPPUNIT_ASSERT_THROW(table.decode(reader), std::ios_base::failure);
+    CPPUNIT_ASSERT_THROW(VlcTable({ { 0b1, 1, 1 }, { 0b10, 2, 2 } }), ConversionException);
+    CPPUNIT_ASSERT_THROW(VlcTable({ { 0b1, 1, 1 }, { 0b1000000000000, 13, 2 } }, 4), ConversionException);
+    CPPUNIT_ASSERT_THROW(VlcTable({ { 0b100, 2, 1 } }), ConversionException);
+    CPPUNIT_ASSERT_THROW(VlcTable({ { 0b1, 1, 1 } }, 17), ConversionException);
+}
+
+/*!
+ * \brief Tests the StreamBitReader class.
+ */
+void IoTests::testStreamBitReader()
+{
+    // write a sequence of values spanning multiple chunks
+    auto writer = BitWriter();
+    for (auto i = 0u; i != 500; ++i) {
+        writer.writeBits(i, 13);
+        writer.writeUnsignedExpGolombCodedBits(i * i);
+        writer.writeSignedExpGolombCodedBits(-static_cast<int>(i));
+        writer.writeBit(i % 3);
+    }
+    writer.writeBits(0xFFFFFFFFFFFFFFFFu, 64);
+    writer.flush();
+    const auto data = writer.takeBuffer();
+
+    const auto checkSequence = [&data](StreamBitReader &reader) {
+        CPPUNIT_ASSERT_EQUAL(static_cast<std::uint64_t>(data.size() * 8), reader.bitsAvailable());
+        for (auto i = 0u; i != 500; ++i) {
+            CPPUNIT_ASSERT_EQUAL(i, reader.readBits<unsigned int>(13));
+            CPPUNIT_ASSERT_EQUAL(i * i, reader.readUnsignedExpGolombCodedBits<unsigned int>());
+            CPPUNIT_ASSERT_EQUAL(-static_cast<int>(i), reader.readSignedExpGolombCodedBits<int>());
+            CPPUNIT_ASSERT_EQUAL(static_cast<std::uint8_t>(i % 3 ? 1 : 0), reader.readBit());
+        }
+        CPPUNIT_ASSERT_EQUAL(static_cast<std::uint64_t>(0xFFFFFFFFFFFFFFFFu), reader.showBits<std::uint64_t>(64));
+        CPPUNIT_ASSERT_EQUAL(static_cast<std::uint64_t>(0xFFFFFFFFFFFFFFFFu), reader.readBits<std::uint64_t>(64));
+        CPPUNIT_ASSERT(reader.bitsAvailable() < 8);
+    };
+
+    // read from a string stream using a small chunk size to test refilling
+    auto stringStream = std::stringstream(data, std::ios_base::in | std::ios_base::binary);
+    auto reader = StreamBitReader(stringStream, 64);
+    CPPUNIT_ASSERT_EQUAL(static_cast<std::size_t>(64), reader.chunkSize());
+    checkSequence(reader);
+    reader.align();
+    CPPUNIT_ASSERT_THROW(reader.readBit(), std::ios_base::failure);
+
+    // read from a file via a BinaryReader
+    const auto path = workingCopyPath("streambitreader.bin", WorkingCopyMode::NoCopy);
+    auto outputStream = NativeFileStream();
+    outputStream.exceptions(std::ios_base::failbit | std::ios_base::badbit);
+    outputStream.open(path, std::ios_base::out | std::ios_base::trunc | std::ios_base::binary);
+    outputStream.write(data.data(), static_cast<std::streamsize>(data.size()));
+    outputStream.close();
+    auto fileStream = NativeFileStream();
+    fileStream.open(path, std::ios_base::in | std::ios_base::binary);
+    auto binaryReader = BinaryReader(&fileStream);
+    auto fileReader = StreamBitReader(binaryReader, 100);
+    checkSequence(fileReader);
+
+    // skip beyond the buffered data which seeks the stream
+    fileStream.clear();
+    binaryReader.seek(0);
+    auto skipReader = StreamBitReader(binaryReader, 100);
+    CPPUNIT_ASSERT_EQUAL(static_cast<unsigned int>(0), skipReader.readBits<unsigned int>(13));
+    skipReader.skipBits(data.size() * 8 - 13 - 64 - 4);
+    CPPUNIT_ASSERT_EQUAL(static_cast<std::uint64_t>(68), skipReader.bitsAvailable());
+    CPPUNIT_ASSERT_EQUAL(static_cast<std::uint64_t>(0xFFFFFFFFFFFFFFFFu), skipReader.readBits<std::uint64_t>(64));
+    CPPUNIT_ASSERT_THROW(skipReader.skipBits(1000), std::ios_base::failure);
+
+    // continue reading from the stream directly after sync()
+    binaryReader.seek(0);
+    auto syncReader = StreamBitReader(binaryReader, 100);
+    syncReader.readBits<std::uint8_t>(3);
+    syncReader.sync();
+    CPPUNIT_ASSERT_EQUAL(static_cast<std::uint64_t>(1), binaryReader.position());
+    CPPUNIT_ASSERT_EQUAL(data[1], binaryReader.readChar());
+    CPPUNIT_ASSERT_EQUAL(static_cast<std::uint8_t>(static_cast<unsigned char>(data[2])), syncReader.prepare(8).readBits<std::uint8_t>(8));
+
+    // hitting the end of a stream shorter than the chunk size must leave the stream usable
+    auto shortStream = std::istringstream(std::string(100, 'U'));
+    auto shortReader = StreamBitReader(shortStream);
+    CPPUNIT_ASSERT_EQUAL(static_cast<std::uint8_t>(0x55), shortReader.readBits<std::uint8_t>(8));
+    CPPUNIT_ASSERT_EQUAL(static_cast<std::uint64_t>(99 * 8), shortReader.bitsAvailable());
+    CPPUNIT_ASSERT(shortStream.good());
+    shortReader.sync();
+    CPPUNIT_ASSERT(shortStream.good());
+    CPPUNIT_ASSERT_EQUAL(static_cast<std::istream::pos_type>(1), shortStream.tellg());
+    CPPUNIT_ASSERT_EQUAL(static_cast<std::uint64_t>(99 * 8), shortReader.bitsAvailable());
+    CPPUNIT_ASSERT_EQUAL(static_cast<std::uint8_t>(0x05), shortReader.readBits<std::uint8_t>(4));
+    shortReader.skipBits(98 * 8);
+    CPPUNIT_ASSERT_EQUAL(static_cast<std::uint64_t>(4), shortReader.bitsAvailable());
+    CPPUNIT_ASSERT_THROW(shortReader.readBits<std::uint8_t>(8), std::ios_base::failure);
+
+    // skip emulation prevention bytes (also across the boundaries of chunks)
+    auto escaped = std::string();
+    for (auto i = 0; i != 50; ++i) {
+        escaped += "\x00\x00\x03\x01"s;
+        escaped += static_cast<char>(i);
+    }
+    auto escapedStream = std::istringstream(escaped);
+    auto escapedReader = StreamBitReader(escapedStream, 64);
+    escapedReader.setSkippingEmulationPreventionBytes(true);
+    CPPUNIT_ASSERT(escapedReader.isSkippingEmulationPreventionBytes());
+    for (auto i = 0; i != 30; ++i) {
+        CPPUNIT_ASSERT_EQUAL(static_cast<std::uint32_t>(0x00000100 | i), escapedReader.readBits<std::uint32_t>(32));
+    }
+    escapedReader.skipBits(10 * 32 + 16);
+    escapedReader.sync();
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("stream positioned after skipped emulation prevention byte", static_cast<std::istream::pos_type>(40 * 5 + 3),
+        escapedStream.tellg());
+    CPPUNIT_ASSERT_EQUAL(static_cast<std::uint16_t>(0x0128), escapedReader.readBits<std::uint16_t>(16));
+    for (auto i = 41; i != 50; ++i) {
+        CPPUNIT_ASSERT_EQUAL(static_cast<std::uint32_t>(0x00000100 | i), escapedReader.readBits<std::uint32_t>(32));
+    }
+    CPPUNIT_ASSERT_THROW(escapedReader.readBit(), std::ios_base::failure);
 }
 
 /*!
@@ -621,6 +1576,189 @@ void IoTests::testReadFile()
 #endif
 }
 
+/*!
+ * \brief Tests the MappedFile class.
+ */
+void IoTests::testMappedFile()
+{
+    auto mappedFile = MappedFile(testFilePath("some_data"), MappedFile::AccessPattern::Sequential);
+    CPPUNIT_ASSERT(mappedFile.isOpen());
+    CPPUNIT_ASSERT_EQUAL(398_st, mappedFile.size());
+    CPPUNIT_ASSERT_EQUAL(readFile(testFilePath("some_data")), std::string(mappedFile.view()));
+    auto reader = mappedFile.reader();
+    CPPUNIT_ASSERT_EQUAL(static_cast<std::uint16_t>(0x0102u), reader.readUInt16LE());
+    CPPUNIT_ASSERT_EQUAL(static_cast<std::uint16_t>(0x0102u), reader.readUInt16BE());
+    mappedFile.advise(MappedFile::AccessPattern::Random, 100, 1000);
+
+    // test moving and closing
+    auto movedFile = std::move(mappedFile);
+    CPPUNIT_ASSERT(!mappedFile.isOpen());
+    CPPUNIT_ASSERT(movedFile.isOpen());
+    CPPUNIT_ASSERT_EQUAL(398_st, movedFile.size());
+    movedFile.close();
+    CPPUNIT_ASSERT(!movedFile.isOpen());
+    CPPUNIT_ASSERT_EQUAL(0_st, movedFile.size());
+
+    // test error handling
+    CPPUNIT_ASSERT_THROW(movedFile.open(testFilePath("some_data") + ".does-not-exist"), std::ios_base::failure);
+    CPPUNIT_ASSERT(!movedFile.isOpen());
+}
+
+/*!
+ * \brief Tests the ReadAheadBuffer class.
+ */
+void IoTests::testReadAheadBuffer()
+{
+    // create a file spanning multiple buffers
+    const auto path = workingCopyPath("read-ahead.bin", WorkingCopyMode::NoCopy);
+    auto data = std::string(100000, '\0');
+    for (std::size_t i = 0; i != data.size(); ++i) {
+        data[i] = static_cast<char>(i * 7 % 251);
+    }
+    writeFile(path, data);
+
+    // read the file sequentially
+    auto buffer = ReadAheadBuffer(path, 4096, 3);
+    CPPUNIT_ASSERT(buffer.isOpen());
+    CPPUNIT_ASSERT_EQUAL(4096_st, buffer.bufferSize());
+    CPPUNIT_ASSERT_EQUAL(3_st, buffer.bufferCount());
+    CPPUNIT_ASSERT_EQUAL(static_cast<std::uint64_t>(data.size()), buffer.fileSize());
+    auto stream = std::istream(&buffer);
+    stream.exceptions(ios_base::badbit);
+    auto reader = BinaryReader(&stream);
+    CPPUNIT_ASSERT_EQUAL(static_cast<istream::pos_type>(data.size()), reader.readStreamsize());
+    CPPUNIT_ASSERT_EQUAL(data.substr(0, 5000), reader.readString(5000));
+    CPPUNIT_ASSERT_EQUAL(static_cast<istream::pos_type>(5000), stream.tellg());
+    CPPUNIT_ASSERT_EQUAL(static_cast<istream::pos_type>(data.size() - 5000), reader.readRemainingBytes());
+    CPPUNIT_ASSERT_EQUAL(data.substr(5000, 60000), reader.readString(60000));
+
+    // seek within and beyond prefetched data
+    stream.seekg(70000);
+    CPPUNIT_ASSERT_EQUAL(data.substr(70000, 100), reader.readString(100));
+    stream.seekg(10);
+    CPPUNIT_ASSERT_EQUAL(data.substr(10, 10000), reader.readString(10000));
+    stream.seekg(-3, ios_base::end);
+    CPPUNIT_ASSERT_EQUAL(data.substr(data.size() - 3), reader.readString(3));
+    CPPUNIT_ASSERT_EQUAL(-1, stream.get());
+    CPPUNIT_ASSERT(stream.eof());
+
+    // read via file descriptor
+    stream.clear();
+#ifdef CPP_UTILITIES_USE_NATIVE_FILE_BUFFER
+    auto nativeStream = NativeFileStream(path, ios_base::in | ios_base::binary);
+    buffer.open(nativeStream.fileDescriptor());
+    CPPUNIT_ASSERT_EQUAL(data.substr(0, 7), reader.readString(7));
+#endif
+    buffer.close();
+    CPPUNIT_ASSERT(!buffer.isOpen());
+    CPPUNIT_ASSERT_EQUAL(-1, stream.get());
+
+    // test error handling
+    CPPUNIT_ASSERT_THROW(buffer.open(path + ".does-not-exist"), std::ios_base::failure);
+    CPPUNIT_ASSERT(!buffer.isOpen());
+}
+
+/*!
+ * \brief Tests the AsyncFileReader class.
+ */
+void IoTests::testAsyncFileReader()
+{
+#ifdef CPP_UTILITIES_USE_NATIVE_FILE_BUFFER
+    const auto path = workingCopyPath("async-read.bin", WorkingCopyMode::NoCopy);
+    auto data = std::string(200000, '\0');
+    for (std::size_t i = 0; i != data.size(); ++i) {
+        data[i] = static_cast<char>(i * 13 % 253);
+    }
+    writeFile(path, data);
+
+    // test both backends (io_uring falls back to the thread pool if not available)
+    for (const auto backend : { AsyncFileReader::Backend::IoUring, AsyncFileReader::Backend::ThreadPool }) {
+        // read many blocks at "random" offsets (more than fit into the queue at once), one of them crossing the end of the file
+        auto file = NativeFileStream(path, ios_base::in | ios_base::binary);
+        auto reader = AsyncFileReader(file, 8, backend);
+        CPPUNIT_ASSERT_EQUAL(file.fileDescriptor(), reader.fileDescriptor());
+        CPPUNIT_ASSERT_EQUAL(8_st, reader.queueDepth());
+        if (backend == AsyncFileReader::Backend::ThreadPool) {
+            CPPUNIT_ASSERT_MESSAGE("thread pool forced", reader.backend() == AsyncFileReader::Backend::ThreadPool);
+        }
+        auto buffers = std::vector<std::string>(100);
+        auto requests = std::vector<AsyncFileReader::Request>(buffers.size());
+        for (std::size_t i = 0; i != requests.size(); ++i) {
+            auto &buffer = buffers[i];
+            auto &request = requests[i];
+            buffer.resize(i * 37 % 2000 + 1);
+            request.offset = i * 7919 % (data.size() - buffer.size());
+            request.length = buffer.size();
+            request.buffer = buffer.data();
+        }
+        requests.back().offset = data.size() - 10;
+        auto completed = std::vector<bool>(requests.size());
+        reader.read(requests, [&](const AsyncFileReader::Request &request, std::size_t bytesRead, const std::error_code &error) {
+            const auto index = static_cast<std::size_t>(&request - requests.data());
+            CPPUNIT_ASSERT(!error);
+            CPPUNIT_ASSERT(!completed[index]);
+            const auto expectedBytes = std::min<std::size_t>(request.length, data.size() - request.offset);
+            CPPUNIT_ASSERT_EQUAL(expectedBytes, bytesRead);
+            CPPUNIT_ASSERT_EQUAL(data.substr(request.offset, bytesRead), std::string(request.buffer, bytesRead));
+            completed[index] = true;
+        });
+        CPPUNIT_ASSERT(std::all_of(completed.begin(), completed.end(), [](bool c) { return c; }));
+        CPPUNIT_ASSERT_EQUAL(static_cast<istream::pos_type>(0), file.tellg());
+
+        // exceptions thrown by the callback are rethrown once all requests have completed
+        auto callbacks = std::size_t();
+        CPPUNIT_ASSERT_THROW(reader.read(requests,
+                                 [&](const AsyncFileReader::Request &, std::size_t, const std::error_code &) {
+                                     ++callbacks;
+                                     throw std::runtime_error("callback failed");
+                                 }),
+            std::runtime_error);
+        CPPUNIT_ASSERT_EQUAL(1_st, callbacks);
+        reader.read(nullptr, 0, [](const AsyncFileReader::Request &, std::size_t, const std::error_code &) { CPPUNIT_FAIL("no request given"); });
+    }
+#endif
+
+#ifdef PLATFORM_LINUX
+    // failures of io_uring_enter() are thrown after waiting for submitted requests; if waiting fails as well the thread pool is used
+    // note: Reading from a pipe keeps the second request in flight until the callback for the first one writes more data.
+    int pipeFds[2];
+    CPPUNIT_ASSERT_EQUAL(0, pipe(pipeFds));
+    auto pipeReader = AsyncFileReader(pipeFds[0], 2);
+    if (pipeReader.backend() == AsyncFileReader::Backend::IoUring) {
+        char pipeBuffers[2] = {};
+        const AsyncFileReader::Request pipeRequests[2] = { { 0, 1, pipeBuffers }, { 0, 1, pipeBuffers + 1 } };
+        const auto writeToPipe = [&](const char *data, std::size_t size) {
+            CPPUNIT_ASSERT_EQUAL(static_cast<ssize_t>(size), write(pipeFds[1], data, size));
+        };
+        auto callbacks = std::size_t();
+        writeToPipe("a", 1);
+        pipeReader.m_simulatedEnterFailures = 0x2;
+        CPPUNIT_ASSERT_THROW(pipeReader.read(pipeRequests, 2,
+                                 [&](const AsyncFileReader::Request &, std::size_t bytesRead, const std::error_code &) {
+                                     CPPUNIT_ASSERT_EQUAL(1_st, bytesRead);
+                                     ++callbacks;
+                                     writeToPipe("b", 1);
+                                 }),
+            std::ios_base::failure);
+        CPPUNIT_ASSERT_EQUAL_MESSAGE("no callback for requests completed after failure", 1_st, callbacks);
+        CPPUNIT_ASSERT_EQUAL_MESSAGE("waited for submitted request", "ab"s, std::string(pipeBuffers, 2));
+        CPPUNIT_ASSERT_MESSAGE("io_uring kept", pipeReader.backend() == AsyncFileReader::Backend::IoUring);
+
+        writeToPipe("cd", 2);
+        pipeReader.read(pipeRequests, 2, [&](const AsyncFileReader::Request &, std::size_t, const std::error_code &error) { CPPUNIT_ASSERT(!error); });
+        CPPUNIT_ASSERT_EQUAL_MESSAGE("io_uring usable after failure", "cd"s, std::string(pipeBuffers, 2));
+
+        writeToPipe("e", 1);
+        pipeReader.m_simulatedEnterFailures = 0x6;
+        CPPUNIT_ASSERT_THROW(
+            pipeReader.read(pipeRequests, 2, [](const AsyncFileReader::Request &, std::size_t, const std::error_code &) {}), std::ios_base::failure);
+        CPPUNIT_ASSERT_MESSAGE("thread pool used if waiting failed", pipeReader.backend() == AsyncFileReader::Backend::ThreadPool);
+    }
+    close(pipeFds[0]);
+    close(pipeFds[1]);
+#endif
+}
+
 /*!
  * \brief Tests writeFile().
  */
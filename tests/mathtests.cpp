@@ -33,6 +33,7 @@ class MathTests : public TestFixture {
     CPPUNIT_TEST(testPowerModulo);
     CPPUNIT_TEST(testInverseModulo);
     CPPUNIT_TEST(testOrderModulo);
+    CPPUNIT_TEST(testCountLeadingZeros);
     CPPUNIT_TEST_SUITE_END();
 
 public:
@@ -48,6 +49,7 @@ public:
     void testPowerModulo();
     void testInverseModulo();
     void testOrderModulo();
+    void testCountLeadingZeros();
 };
 
 CPPUNIT_TEST_SUITE_REGISTRATION(MathTests);
@@ -82,3 +84,17 @@ void MathTests::testOrderModulo()
     CPPUNIT_ASSERT_EQUAL(5u, orderModulo(6u, 25u));
     CPPUNIT_ASSERT_EQUAL(0u, orderModulo(5u, 25u));
 }
+
+void MathTests::testCountLeadingZeros()
+{
+    static_assert(countLeadingZeros(static_cast<std::uint8_t>(0x10)) == 3, "usable in constant expressions");
+    CPPUNIT_ASSERT_EQUAL(8, countLeadingZeros(static_cast<std::uint8_t>(0)));
+    CPPUNIT_ASSERT_EQUAL(0, countLeadingZeros(static_cast<std::uint8_t>(0x80)));
+    CPPUNIT_ASSERT_EQUAL(7, countLeadingZeros(static_cast<std::uint8_t>(0x01)));
+    CPPUNIT_ASSERT_EQUAL(15, countLeadingZeros(static_cast<std::uint16_t>(1)));
+    CPPUNIT_ASSERT_EQUAL(32, countLeadingZeros(static_cast<std::uint32_t>(0)));
+    CPPUNIT_ASSERT_EQUAL(12, countLeadingZeros(static_cast<std::uint32_t>(0x000F0000)));
+    CPPUNIT_ASSERT_EQUAL(0, countLeadingZeros(static_cast<std::uint64_t>(0x8000000000000000)));
+    CPPUNIT_ASSERT_EQUAL(63, countLeadingZeros(static_cast<std::uint64_t>(1)));
+    CPPUNIT_ASSERT_EQUAL(64, countLeadingZeros(static_cast<std::uint64_t>(0)));
+}